@@ -3,11 +3,17 @@
 // Created Date: 29 Nov 2023.
 //
 
-#include "random"
 #include "iterator"
+#include <algorithm>
 #include <cmath>
-#include <chrono>
+#include <limits>
 #include "algebra.h"
+#include "elementwise.h"
+#include "elimination.h"
+#include "gemm.h"
+#include "lu.h"
+#include "transpose.h"
+#include "workspace.h"
 
 using std::cout;
 using std::endl;
@@ -28,16 +34,10 @@ namespace algebra {
 
     Matrix random(size_t n, size_t m, double min, double max) {
         if (min > max) throw logic_error("min should be less than max");
-        // Define a random engine.
-        static std::default_random_engine e(std::chrono::system_clock::now().time_since_epoch().count());
-        std::uniform_real_distribution<double> u(min, max);
-        Matrix matrix(n, vector<double>(m));
-        for (auto& row : matrix) {
-            for (auto& element : row) {
-                element = u(e);  // Generate a random value for each element.
-            }
-        }
-        return matrix;
+        // Fill a contiguous matrix in parallel, then convert it once.
+        DenseMatrix matrix(n, m);
+        random(matrix, min, max);
+        return matrix.to_matrix();
     }
 
     void show(const Matrix& matrix) {
@@ -52,303 +52,508 @@ namespace algebra {
     Matrix multiply(const Matrix& matrix, double c) {
         // Check if the matrix is empty, and throw an exception if so.
         if (matrix.empty()) throw logic_error("The matrix should not be empty.");
-        Matrix res;
-        // Iterate by row.
-        for (const auto & i : matrix) {
-            vector<double> v;
-            // Generate the elements of a row.
-            for (double j : i) {
-                v.push_back(j * c);
-            }
-            res.push_back(v);
+        return multiply(DenseMatrix(matrix), c).to_matrix();
+    }
+
+    Matrix multiply(const Matrix& matrix1, const Matrix& matrix2) {
+        // Check if either matrix is empty, and return an empty matrix if so.
+        if (matrix1.empty() || matrix2.empty()) return {};
+        return multiply(DenseMatrix(matrix1), DenseMatrix(matrix2)).to_matrix();
+    }
+
+    Matrix sum(const Matrix& matrix, double c) {
+        // Check if the matrix is empty, return an empty matrix.
+        if (matrix.empty()) return {};
+        return sum(DenseMatrix(matrix), c).to_matrix();
+    }
+
+    Matrix sum(const Matrix& matrix1, const Matrix& matrix2) {
+        // Check if both matrix is empty, return an empty matrix if so.
+        if (matrix1.empty() && matrix2.empty()) return {};
+        // Check if either matrix is empty, throw an error if so.
+        if (matrix1.empty() || matrix2.empty())
+            throw logic_error("There is at least an empty matrix");
+        return sum(DenseMatrix(matrix1), DenseMatrix(matrix2)).to_matrix();
+    }
+
+    Matrix transpose(const Matrix& matrix) {
+        // Check if the matrix is empty, return an empty matrix if true
+        if (matrix.empty()) return {};
+        return transpose(DenseMatrix(matrix)).to_matrix();
+    }
+
+    Matrix minor(const Matrix& matrix, size_t n, size_t m) {
+        // Check if the matrix is empty, return an empty matrix if true
+        if (matrix.empty()) return {};
+        return minor(DenseMatrix(matrix), n, m).to_matrix();
+    }
+
+    double determinant(const Matrix& matrix) {
+        // Check if the matrix is empty, return 1 as the determinant of an empty matrix
+        if (matrix.empty()) return 1;
+        return determinant(DenseMatrix(matrix));
+    }
+
+    Matrix inverse(const Matrix& matrix) {
+        // Check if the matrix is empty, return an empty matrix if true
+        if (matrix.empty()) return {};
+        return inverse(DenseMatrix(matrix)).to_matrix();
+    }
+
+    Matrix solve(const Matrix& matrix, const Matrix& b) {
+        // Check if the system is empty, return an empty matrix if true
+        if (matrix.empty() && b.empty()) return {};
+        return solve(DenseMatrix(matrix), DenseMatrix(b)).to_matrix();
+    }
+
+    Matrix lstsq(const Matrix& matrix, const Matrix& b) {
+        // Check if the system is empty, return an empty matrix if true
+        if (matrix.empty() && b.empty()) return {};
+        return lstsq(DenseMatrix(matrix), DenseMatrix(b)).to_matrix();
+    }
+
+    Matrix concatenate(const Matrix& matrix1, const Matrix& matrix2, int axis) {
+        // If one matrix is empty, return another
+        if (matrix1.empty()) return matrix2;
+        if (matrix2.empty()) return matrix1;
+        return concatenate(DenseMatrix(matrix1), DenseMatrix(matrix2), axis).to_matrix();
+    }
+
+    void ero_swap_in_place(Matrix& matrix, size_t r1, size_t r2) {
+        // Check if the row indices are within the bounds of the matrix
+        size_t size = matrix.size();
+        if (r1 >= size || r2 >= size) throw logic_error("The parameter r1 or r2 is out of range.");
+        // Swap the rows r1 and r2, only the row buffers are exchanged
+        std::swap(matrix[r1], matrix[r2]);
+    }
+
+    void ero_multiply_in_place(Matrix& matrix, size_t r, double c) {
+        // Check if the row index is within the bounds of the matrix
+        if (r >= matrix.size()) throw logic_error("The parameter r is out of range.");
+        // Multiply each element in row r by the constant c
+        for (double& element : matrix[r]) {
+            element *= c;
+        }
+    }
+
+    void ero_sum_in_place(Matrix& matrix, size_t r1, double c, size_t r2) {
+        // Check if the row indices are within the bounds of the matrix
+        size_t size = matrix.size();
+        if (r1 >= size || r2 >= size) throw logic_error("The parameter r1 or r2 is out of range.");
+        // Add c times row r1 to row r2
+        for (size_t i = 0; i < matrix[r1].size(); i++) {
+            matrix[r2][i] += matrix[r1][i] * c;
         }
+    }
+
+    Matrix ero_swap(const Matrix& matrix, size_t r1, size_t r2) {
+        // Work on a copy of the matrix
+        Matrix res(matrix);
+        ero_swap_in_place(res, r1, r2);
         return res;
     }
 
-    Matrix multiply(const Matrix& matrix1, const Matrix& matrix2) {
+    Matrix ero_multiply(const Matrix& matrix, size_t r, double c) {
+        // Work on a copy of the matrix
+        Matrix res(matrix);
+        ero_multiply_in_place(res, r, c);
+        return res;
+    }
+
+    Matrix ero_sum(const Matrix& matrix, size_t r1, double c, size_t r2) {
+        // Work on a copy of the matrix
+        Matrix res(matrix);
+        ero_sum_in_place(res, r1, c, r2);
+        return res;
+    }
+
+    Matrix upper_triangular(const Matrix& matrix) {
+        // Check if the matrix is empty, return an empty matrix if so
+        if (matrix.empty()) return {};
+        // The conversion is the only copy of the input
+        DenseMatrix res(matrix);
+        upper_triangular_in_place(res);
+        return res.to_matrix();
+    }
+
+    template <typename T>
+    void random(BasicDenseMatrix<T>& matrix, double min, double max) {
+        // Every call takes a fresh stream of the counter-based generator.
+        random(matrix, Distribution::uniform, min, max, next_seed());
+    }
+
+    template <typename T>
+    void show(const BasicDenseMatrix<T>& matrix) {
+        for (size_t i = 0; i < matrix.rows(); i++) {
+            // std::copy to iterator to cout to print.
+            copy(matrix.row(i), matrix.row(i) + matrix.cols(),
+                 ostream_iterator<T>(cout, " "));
+            cout << endl;
+        }
+    }
+
+    template <typename T>
+    BasicDenseMatrix<T> multiply(const BasicDenseMatrix<T>& matrix, double c) {
+        // Check if the matrix is empty, and throw an exception if so.
+        if (matrix.empty()) throw logic_error("The matrix should not be empty.");
+        BasicDenseMatrix<T> res(matrix.rows(), matrix.cols());
+        // Both buffers have the same layout and the padding stays zero, so scale them as a whole.
+        kernel::scale(matrix.data(), static_cast<T>(c), res.data(), matrix.rows() * matrix.stride());
+        return res;
+    }
+
+    // A helper function to return true if no element of the matrix is infinite or NaN.
+    static bool all_finite(const DenseMatrix& matrix) {
+        for (size_t i = 0; i < matrix.rows(); i++)
+            for (size_t j = 0; j < matrix.cols(); j++)
+                if (!std::isfinite(matrix(i, j))) return false;
+        return true;
+    }
+
+    // A helper function to multiply a mostly zero matrix1 as a sparse matrix, return false if it is not one.
+    // The sparse product skips the zeros of matrix1, which only gives the dense result when every element
+    // of matrix2 is finite: 0 * Inf is NaN. The sparse matrices only hold doubles.
+    static bool multiply_sparse(const DenseMatrix& matrix1, const DenseMatrix& matrix2, DenseMatrix& res) {
+        if (matrix1.rows() * matrix1.cols() * matrix2.cols() < sparse_min_work || !prefer_sparse(matrix1) ||
+            !all_finite(matrix2))
+            return false;
+        res = multiply(SparseMatrix(matrix1), matrix2);
+        return true;
+    }
+
+    static bool multiply_sparse(const DenseMatrixF&, const DenseMatrixF&, DenseMatrixF&) {
+        return false;
+    }
+
+    template <typename T>
+    BasicDenseMatrix<T> multiply(const BasicDenseMatrix<T>& matrix1, const BasicDenseMatrix<T>& matrix2) {
         // Check if either matrix is empty, and return an empty matrix if so.
         if (matrix1.empty() || matrix2.empty()) return {};
         // Check for compatible dimensions for matrix multiplication.
-        if (matrix1[0].size() != matrix2.size())
+        if (matrix1.cols() != matrix2.rows())
             throw logic_error("The number of columns in the first matrix must equal "
                               "the number of rows in the second matrix.");
         // Define the dimensions of the result matrix.
-        size_t rows = matrix1.size();
-        size_t cols = matrix2[0].size();
-        size_t inner = matrix1[0].size();
+        size_t rows = matrix1.rows();
+        size_t cols = matrix2.cols();
+        size_t inner = matrix1.cols();
+        // A mostly zero left operand skips its zeros.
+        BasicDenseMatrix<T> res;
+        if (multiply_sparse(matrix1, matrix2, res)) return res;
+        // A large product saves multiplications by the Strassen-Winograd recursion.
+        if (prefer_strassen(rows, cols, inner)) return multiply_strassen(matrix1, matrix2);
         // Create a result matrix filled with zeros
-        Matrix res(rows, std::vector<double>(cols));
-        // Perform matrix multiplication
-        for (size_t i = 0; i < rows; i++) {
-            for (size_t j = 0; j < cols; j++) {
-                for (size_t k = 0; k < inner; k++) {
-                    // Accumulate the product of corresponding elements
-                    res[i][j] += matrix1[i][k] * matrix2[k][j];
-                }
-            }
-        }
+        res = BasicDenseMatrix<T>(rows, cols);
+        // Accumulate the product by the cache blocked kernel on the thread pool
+        kernel::gemm_parallel(rows, cols, inner, matrix1.data(), matrix1.stride(),
+                              matrix2.data(), matrix2.stride(), res.data(), res.stride());
         return res;
     }
 
-    Matrix sum(const Matrix& matrix, double c) {
+    DenseMatrixF multiply_mixed(const DenseMatrixF& matrix1, const DenseMatrixF& matrix2) {
+        // Check if either matrix is empty, and return an empty matrix if so.
+        if (matrix1.empty() || matrix2.empty()) return {};
+        // Check for compatible dimensions for matrix multiplication.
+        if (matrix1.cols() != matrix2.rows())
+            throw logic_error("The number of columns in the first matrix must equal "
+                              "the number of rows in the second matrix.");
+        DenseMatrixF res(matrix1.rows(), matrix2.cols());
+        kernel::gemm_mixed(matrix1.rows(), matrix2.cols(), matrix1.cols(), matrix1.data(), matrix1.stride(),
+                           matrix2.data(), matrix2.stride(), res.data(), res.stride());
+        return res;
+    }
+
+    template <typename T>
+    BasicDenseMatrix<T> sum(const BasicDenseMatrix<T>& matrix, double c) {
         // Check if the matrix is empty, return an empty matrix.
         if (matrix.empty()) return {};
-        Matrix res;
-        // Perform the sum of two matrix.
-        for (const auto & i : matrix) {
-            vector<double> v;
-            // Add c to every element of a row.
-            for (double j : i) {
-                v.push_back(j + c);
-            }
-            res.push_back(v);
+        BasicDenseMatrix<T> res(matrix.rows(), matrix.cols());
+        // Add c to every element of a row, row by row so the padding stays zero.
+        for (size_t i = 0; i < matrix.rows(); i++) {
+            kernel::shift(matrix.row(i), static_cast<T>(c), res.row(i), matrix.cols());
         }
         return res;
     }
 
-    Matrix sum(const Matrix& matrix1, const Matrix& matrix2) {
+    template <typename T>
+    BasicDenseMatrix<T> sum(const BasicDenseMatrix<T>& matrix1, const BasicDenseMatrix<T>& matrix2) {
         // Check if both matrix is empty, return an empty matrix if so.
         if (matrix1.empty() && matrix2.empty()) return {};
         // Check if either matrix is empty, throw an error if so.
         if (matrix1.empty() || matrix2.empty())
             throw logic_error("There is at least an empty matrix");
         // Check if both matrices have same dimensions.
-        if (matrix1.size() != matrix2.size() || matrix1[0].size() != matrix2[0].size())
+        if (matrix1.rows() != matrix2.rows() || matrix1.cols() != matrix2.cols())
             throw logic_error("Both matrices must have the same dimensions.");
-        // Create a result matrix.
-        Matrix res;
-        // Perform the sum.
-        for (size_t i = 0; i < matrix1.size(); i++) {
-            vector<double> v;
-            for (size_t j = 0; j < matrix1[i].size(); j++) {
-                // Apply the sum by elements by 2 matrices.
-                v.push_back(matrix1[i][j] + matrix2[i][j]);
-            }
-            res.push_back(v);
-        }
+        BasicDenseMatrix<T> res(matrix1.rows(), matrix1.cols());
+        // Apply the sum by elements by 2 matrices, the buffers have the same layout.
+        kernel::add(matrix1.data(), matrix2.data(), res.data(), matrix1.rows() * matrix1.stride());
         return res;
     }
 
-    Matrix transpose(const Matrix& matrix) {
+    template <typename T>
+    BasicDenseMatrix<T> transpose(const BasicDenseMatrix<T>& matrix) {
         // Check if the matrix is empty, return an empty matrix if true
         if (matrix.empty()) return {};
-        // Determine the number of rows and columns for the transposed matrix
-        size_t rows = matrix[0].size(); // Rows in the transposed matrix equal columns in the original
-        size_t cols = matrix.size();    // Columns in the transposed matrix equal rows in the original
-        // Create a new matrix with dimensions of the transposed matrix
-        Matrix res{rows, vector<double>(cols)};
-        // Iterate over the matrix to transpose it
-        for (size_t i = 0; i < rows; i++) {
-            for (size_t j = 0; j < cols; j++) {
-                // Assign elements to their transposed positions
-                res[i][j] = matrix[j][i];
-            }
-        }
+        // Rows in the transposed matrix equal columns in the original
+        BasicDenseMatrix<T> res(matrix.cols(), matrix.rows());
+        // Move the elements tile by tile, so the writes do not miss the cache
+        kernel::transpose(matrix.rows(), matrix.cols(), matrix.data(), matrix.stride(), res.data(), res.stride());
         return res;
     }
 
-    Matrix minor(const Matrix& matrix, size_t n, size_t m) {
+    void transpose_in_place(Matrix& matrix) {
+        // Check if the matrix is square
+        if (!matrix.empty() && matrix.size() != matrix[0].size())
+            throw logic_error("The matrix should be square.");
+        for (size_t i = 0; i < matrix.size(); i++)
+            for (size_t j = i + 1; j < matrix.size(); j++) std::swap(matrix[i][j], matrix[j][i]);
+    }
+
+    template <typename T>
+    void transpose_in_place(BasicDenseMatrix<T>& matrix) {
+        // Check if the matrix is square
+        if (matrix.rows() != matrix.cols()) throw logic_error("The matrix should be square.");
+        kernel::transpose_in_place(matrix.rows(), matrix.data(), matrix.stride());
+    }
+
+    template <typename T>
+    BasicDenseMatrix<T> minor(const BasicDenseMatrix<T>& matrix, size_t n, size_t m) {
         // Check if the matrix is empty, return an empty matrix if true
         if (matrix.empty()) return {};
         // Check if n and m are within the bounds of the matrix dimensions
-        if (m >= matrix.size() || n >= matrix[0].size())
+        if (n >= matrix.rows() || m >= matrix.cols())
             throw logic_error("Illegal parameter n or m");
-        // Initialize an empty matrix for the result
-        Matrix res;
-        // Iterate over the rows of the matrix
-        for (size_t i = 0; i < matrix.size(); i++) {
+        BasicDenseMatrix<T> res(matrix.rows() - 1, matrix.cols() - 1);
+        for (size_t i = 0, r = 0; i < matrix.rows(); i++) {
             // Skip the row n, as it's not included in the minor
             if (i == n) continue;
-            vector<double> v; // A vector to store the row of the minor matrix
-            // Iterate over the columns of the matrix
-            for (size_t j = 0; j < matrix[i].size(); j++) {
-                // Skip the column m, as it's not included in the minor
-                if (j == m) continue;
-                // Add the element to the row vector
-                v.push_back(matrix[i][j]);
-            }
-            // Add the row vector to the minor matrix
-            res.push_back(v);
+            const T *src = matrix.row(i);
+            T *dst = res.row(r++);
+            // Copy the columns before and after the column m
+            std::copy(src, src + m, dst);
+            std::copy(src + m + 1, src + matrix.cols(), dst + m);
         }
         return res;
     }
 
-    double determinant(const Matrix& matrix) {
-        // Check if the matrix is empty, return 1 as the determinant of an empty matrix
-        if (matrix.empty()) return 1;
-        // Base case: if the matrix is 1x1, return the single element
-        if (matrix.size() == 1) return matrix[0][0];
-        // Initialize the determinant result
-        double res = 0;
-        // Iterate over the elements of the first row
-        for (size_t i = 0; i < matrix[0].size(); i++) {
-            // Compute the minor of the matrix excluding the current row and column
-            Matrix small_matrix = minor(matrix, 0, i);
-            // Calculate the cofactor of the current element
-            double cofactor = (determinant(small_matrix)) * (pow(-1, i));
-            // Add the product of the element and its cofactor to the determinant
-            res += matrix[0][i] * cofactor;
-        }
-        return res;
+    // The factorizations work in double, a float matrix is converted once.
+    static const DenseMatrix& as_double(const DenseMatrix& matrix) {
+        return matrix;
     }
 
-    // The help function to calculate the adjoint of a given square matrix
-    Matrix adjoint(const Matrix& matrix) {
-        // Check if the matrix is empty or not square, throw an error if so
-        if (matrix.empty() || matrix.size() != matrix[0].size())
-            throw logic_error("Matrix must be non-empty and square.");
-        // Get the size of the matrix
-        size_t n = matrix.size();
-        // Create an n x n matrix initialized with zeros, to hold the adjoint
-        Matrix adj = zeros(n, n);
-        // Iterate over all elements in the matrix
-        for (size_t i = 0; i < n; i++) {
-            for (size_t j = 0; j < n; j++) {
-                // Calculate the minor of the matrix excluding the current row (i) and column (j)
-                Matrix min = minor(matrix, i, j);
-                // Calculate the cofactor of the current element
-                double cofactor = determinant(min) * (pow(-1, i + j));
-                // Set the cofactor in the transposed position in the adjoint matrix
-                adj[j][i] = cofactor;
-            }
-        }
-        return adj;
+    static DenseMatrix as_double(const DenseMatrixF& matrix) {
+        return DenseMatrix(matrix);
     }
 
-    Matrix inverse(const Matrix& matrix) {
+    template <typename T>
+    double determinant(const BasicDenseMatrix<T>& matrix) {
+        // Check if the matrix is empty, return 1 as the determinant of an empty matrix
+        if (matrix.empty()) return 1;
+        // Check if the matrix is square
+        if (matrix.rows() != matrix.cols()) throw logic_error("The matrix should be square.");
+        // Take the product of the pivots of the LU factorization, O(n^3)
+        return LU(as_double(matrix)).determinant();
+    }
+
+    template <typename T>
+    BasicDenseMatrix<T> inverse(const BasicDenseMatrix<T>& matrix) {
         // Check if the matrix is empty, return an empty matrix if true
         if (matrix.empty()) return {};
-        // Calculate the determinant of the matrix
-        double det = determinant(matrix);
-        // Check if the determinant is close to zero (matrix is non-invertible)
-        if (abs(det) < 1e-9) throw logic_error("Matrix is not invertible.");
-        // Calculate the adjoint of the matrix
-        Matrix adj = adjoint(matrix);
-        // Multiply the adjoint by 1/determinant to get the inverse
-        // This is based on the formula: inverse(matrix) = adjoint(matrix) / determinant(matrix)
-        Matrix inv = multiply(adj, 1.0 / det);
-        return inv;
-    }
-
-
-    // A helper function to concatenate two matrices by rows
-    Matrix concatenate_by_row(const Matrix& matrix1, const Matrix& matrix2) {
-        // Check if both matrices have the same number of rows
-        if (matrix1.size() != matrix2.size())
-            throw logic_error("The two matrices should have the same number of rows.");
-        // Initialize an empty matrix to store the result
-        Matrix res;
-        // Iterate over the rows of the matrices
-        for (int i = 0; i < matrix1.size(); i++) {
-            vector<double> v; // Create a temporary vector to store the concatenated row
-            // Insert all elements of the ith row of the first matrix into v
-            v.insert(v.end(), matrix1[i].begin(), matrix1[i].end());
-            // Insert all elements of the ith row of the second matrix into v
-            v.insert(v.end(), matrix2[i].begin(), matrix2[i].end());
-            // Add the concatenated row to the resulting matrix
-            res.push_back(v);
-        }
-        return res;
+        // Factorize once, the inverse is solved from the factors in O(n^3)
+        LU factorization(as_double(matrix));
+        // Check if the matrix is singular or too ill-conditioned to be inverted
+        if (factorization.singular() || factorization.rcond() < std::numeric_limits<double>::epsilon())
+            throw logic_error("Matrix is not invertible.");
+        return BasicDenseMatrix<T>(factorization.inverse());
+    }
+
+    template <typename T>
+    BasicDenseMatrix<T> solve(const BasicDenseMatrix<T>& matrix, const BasicDenseMatrix<T>& b) {
+        // Check if the system is empty, return an empty matrix if true
+        if (matrix.empty() && b.empty()) return {};
+        // The factorization checks the shapes
+        return BasicDenseMatrix<T>(LU(as_double(matrix)).solve(as_double(b)));
+    }
+
+    std::vector<double> solve(const DenseMatrix& matrix, const std::vector<double>& b) {
+        if (matrix.empty() && b.empty()) return {};
+        return LU(matrix).solve(b);
+    }
+
+    // A helper function to solve the least squares in double.
+    static DenseMatrix least_squares(const DenseMatrix& matrix, const DenseMatrix& b) {
+        // Check if the right-hand sides fit the matrix
+        if (b.rows() != matrix.rows())
+            throw logic_error("The right-hand side should have as many rows as the matrix.");
+        if (matrix.rows() >= matrix.cols()) return QR(matrix).solve(b);
+        // A wide matrix is the transpose of a tall one, its QR gives the solution of the smallest norm.
+        DenseMatrix tall(matrix.cols(), matrix.rows());
+        kernel::transpose(matrix.rows(), matrix.cols(), matrix.data(), matrix.stride(), tall.data(), tall.stride());
+        return QR(tall).solve_transposed(b);
+    }
+
+    template <typename T>
+    BasicDenseMatrix<T> lstsq(const BasicDenseMatrix<T>& matrix, const BasicDenseMatrix<T>& b) {
+        // Check if the system is empty, return an empty matrix if true
+        if (matrix.empty() && b.empty()) return {};
+        return BasicDenseMatrix<T>(least_squares(as_double(matrix), as_double(b)));
     }
 
-    // A helper function to concatenate two matrices by columns
-    Matrix concatenate_by_column(const Matrix& matrix1, const Matrix& matrix2) {
-        // Check if both matrices have the same number of columns
-        if (matrix1[0].size() != matrix2[0].size())
-            throw logic_error("The two matrix should have same row length.");
-        // Initialize an empty matrix to store the result
-        Matrix res;
-        // Insert all elements of the ith cols of the first matrix into v
-        res.insert(res.end(), matrix1.begin(), matrix1.end());
-        // Insert all elements of the ith cols of the second matrix into v
-        res.insert(res.end(), matrix2.begin(), matrix2.end());
+    std::vector<double> lstsq(const DenseMatrix& matrix, const std::vector<double>& b) {
+        if (matrix.empty() && b.empty()) return {};
+        DenseMatrix column(b.size(), 1);
+        for (size_t i = 0; i < b.size(); i++) column(i, 0) = b[i];
+        column = least_squares(matrix, column);
+        std::vector<double> res(column.rows());
+        for (size_t i = 0; i < res.size(); i++) res[i] = column(i, 0);
         return res;
     }
 
-    Matrix concatenate(const Matrix& matrix1, const Matrix& matrix2, int axis) {
+    template <typename T>
+    BasicDenseMatrix<T> concatenate(const BasicDenseMatrix<T>& matrix1, const BasicDenseMatrix<T>& matrix2, int axis) {
         // If one matrix is empty, return another
         if (matrix1.empty()) return matrix2;
         if (matrix2.empty()) return matrix1;
-        // If axis is 0, concatenate the matrices by column
-        if (!axis) return concatenate_by_column(matrix1, matrix2);
-            // If axis is 1, concatenate the matrices by row
-        else if (axis == 1) return concatenate_by_row(matrix1, matrix2);
-            // If axis is neither 0 nor 1, throw an error
+        if (!axis) {
+            // Concatenate the matrices by column, both should have the same number of columns
+            if (matrix1.cols() != matrix2.cols())
+                throw logic_error("The two matrix should have same row length.");
+            BasicDenseMatrix<T> res(matrix1.rows() + matrix2.rows(), matrix1.cols());
+            for (size_t i = 0; i < matrix1.rows(); i++)
+                std::copy(matrix1.row(i), matrix1.row(i) + matrix1.cols(), res.row(i));
+            for (size_t i = 0; i < matrix2.rows(); i++)
+                std::copy(matrix2.row(i), matrix2.row(i) + matrix2.cols(), res.row(matrix1.rows() + i));
+            return res;
+        } else if (axis == 1) {
+            // Concatenate the matrices by row, both should have the same number of rows
+            if (matrix1.rows() != matrix2.rows())
+                throw logic_error("The two matrices should have the same number of rows.");
+            BasicDenseMatrix<T> res(matrix1.rows(), matrix1.cols() + matrix2.cols());
+            for (size_t i = 0; i < matrix1.rows(); i++) {
+                T *dst = std::copy(matrix1.row(i), matrix1.row(i) + matrix1.cols(), res.row(i));
+                std::copy(matrix2.row(i), matrix2.row(i) + matrix2.cols(), dst);
+            }
+            return res;
+        }
+        // If axis is neither 0 nor 1, throw an error
         else throw logic_error("The axis should be 0 or 1.");
     }
 
-    Matrix ero_swap(const Matrix& matrix, size_t r1, size_t r2) {
+    template <typename T>
+    void ero_swap_in_place(BasicDenseMatrix<T>& matrix, size_t r1, size_t r2) {
         // Check if the row indices are within the bounds of the matrix
-        size_t size = matrix.size();
-        if (r1 >= size || r2 >= size) throw logic_error("The parameter r1 or r2 is out of range.");
-        // Create a copy of the matrix
-        Matrix res(matrix);
+        if (r1 >= matrix.rows() || r2 >= matrix.rows()) throw logic_error("The parameter r1 or r2 is out of range.");
         // Swap the rows r1 and r2
-        res[r1] = res[r2];
-        res[r2] = matrix[r1];
-        return res;
+        if (r1 != r2) std::swap_ranges(matrix.row(r1), matrix.row(r1) + matrix.cols(), matrix.row(r2));
     }
 
-
-    Matrix ero_multiply(const Matrix& matrix, size_t r, double c) {
+    template <typename T>
+    void ero_multiply_in_place(BasicDenseMatrix<T>& matrix, size_t r, double c) {
         // Check if the row index is within the bounds of the matrix
-        if (r >= matrix.size()) throw logic_error("The parameter r is out of range.");
-        // Create a copy of the matrix
-        Matrix res(matrix);
+        if (r >= matrix.rows()) throw logic_error("The parameter r is out of range.");
         // Multiply each element in row r by the constant c
-        for (int i = 0; i < matrix[r].size(); i++) {
-            res[r][i] = matrix[r][i] * c;
+        T *row = matrix.row(r);
+        for (size_t i = 0; i < matrix.cols(); i++) {
+            row[i] *= c;
         }
-        return res;
     }
 
-    Matrix ero_sum(const Matrix& matrix, size_t r1, double c, size_t r2) {
+    template <typename T>
+    void ero_sum_in_place(BasicDenseMatrix<T>& matrix, size_t r1, double c, size_t r2) {
         // Check if the row indices are within the bounds of the matrix
-        size_t size = matrix.size();
-        if (r1 >= size || r2 >= size) throw logic_error("The parameter r1 or r2 is out of range.");
-        // Create a copy of the matrix
-        Matrix res(matrix);
+        if (r1 >= matrix.rows() || r2 >= matrix.rows()) throw logic_error("The parameter r1 or r2 is out of range.");
         // Add c times row r1 to row r2
-        for (int i = 0; i < matrix[r1].size(); i++) {
-            res[r2][i] = matrix[r1][i] * c + matrix[r2][i];
+        const T *src = matrix.row(r1);
+        T *dst = matrix.row(r2);
+        for (size_t i = 0; i < matrix.cols(); i++) {
+            dst[i] += src[i] * c;
         }
+    }
+
+    template <typename T>
+    BasicDenseMatrix<T> ero_swap(const BasicDenseMatrix<T>& matrix, size_t r1, size_t r2) {
+        // Work on a copy of the matrix
+        BasicDenseMatrix<T> res(matrix);
+        ero_swap_in_place(res, r1, r2);
         return res;
     }
 
-    // A helper function to perform ero swap when a diagonal element is zero
-    void ero_swap_when_zero_diagonal(Matrix& matrix, int i) {
-        // Check if the current diagonal element is close to zero
-        if (abs(matrix[i][i]) > 1e-9) return;
-        // Iterate over the rows below the current row
-        for (int j = i + 1; j < matrix.size(); j++) {
-            // Check for a non-zero element in the same column
-            if (abs(matrix[j][i]) > 1e-9) {
-                // Perform ero_swap if a suitable row is found
-                ero_swap(matrix, i, j);
-                break;
-            }
-        }
+    template <typename T>
+    BasicDenseMatrix<T> ero_multiply(const BasicDenseMatrix<T>& matrix, size_t r, double c) {
+        // Work on a copy of the matrix
+        BasicDenseMatrix<T> res(matrix);
+        ero_multiply_in_place(res, r, c);
+        return res;
     }
 
-    Matrix upper_triangular(const Matrix& matrix) {
+    template <typename T>
+    BasicDenseMatrix<T> ero_sum(const BasicDenseMatrix<T>& matrix, size_t r1, double c, size_t r2) {
+        // Work on a copy of the matrix
+        BasicDenseMatrix<T> res(matrix);
+        ero_sum_in_place(res, r1, c, r2);
+        return res;
+    }
+
+    // The elimination leaves the multipliers below the diagonal, clear them.
+    template <typename T>
+    static void eliminate_in_place(BasicDenseMatrix<T>& matrix, size_t *permutation) {
+        size_t n = matrix.rows();
+        kernel::eliminate(n, matrix.data(), matrix.stride(), permutation);
+        for (size_t i = 1; i < n; i++)
+            std::fill(matrix.row(i), matrix.row(i) + i, T(0));
+    }
+
+    template <typename T>
+    std::vector<size_t> upper_triangular_in_place(BasicDenseMatrix<T>& matrix) {
+        // Check if the matrix is square
+        if (matrix.rows() != matrix.cols()) throw logic_error("The matrix should be square.");
+        std::vector<size_t> permutation(matrix.rows());
+        eliminate_in_place(matrix, permutation.data());
+        return permutation;
+    }
+
+    template <typename T>
+    BasicDenseMatrix<T> upper_triangular(const BasicDenseMatrix<T>& matrix) {
         // Check if the matrix is empty, return an empty matrix if so
         if (matrix.empty()) return {};
+        // Copy the input matrix once and work on it
+        BasicDenseMatrix<T> res(matrix);
         // Check if the matrix is square
-        if (matrix.size() != matrix[0].size()) throw logic_error("The matrix should be square.");
-        // Copy the input matrix to work on
-        Matrix res(matrix);
-        // Iterate over the columns of the matrix
-        for (int i = 0; i < res.size(); i++) {
-            // Perform ero swap for zero diagonal elements
-            ero_swap_when_zero_diagonal(res, i);
-            // Perform row-wise elimination
-            for (int j = i + 1; j < res.size(); j++) {
-                // Skip if the element is close to zero
-                if (abs(res[j][i]) <= 1e-9) continue;
-                // Perform ero sum to zero out the elements below the diagonal
-                res = ero_sum(res, i, -res[j][i] / res[i][i], j);
-            }
-        }
+        if (res.rows() != res.cols()) throw logic_error("The matrix should be square.");
+        // The permutation is not returned, it lives in the workspace.
+        Scratch<size_t> permutation(res.rows());
+        eliminate_in_place(res, permutation.data());
         return res;
     }
+
+    // Compile the dense functions for both scalar types.
+#define ALGEBRA_INSTANTIATE(T) \
+    template void random(BasicDenseMatrix<T>& matrix, double min, double max); \
+    template void show(const BasicDenseMatrix<T>& matrix); \
+    template BasicDenseMatrix<T> multiply(const BasicDenseMatrix<T>& matrix, double c); \
+    template BasicDenseMatrix<T> multiply(const BasicDenseMatrix<T>& matrix1, const BasicDenseMatrix<T>& matrix2); \
+    template BasicDenseMatrix<T> sum(const BasicDenseMatrix<T>& matrix, double c); \
+    template BasicDenseMatrix<T> sum(const BasicDenseMatrix<T>& matrix1, const BasicDenseMatrix<T>& matrix2); \
+    template BasicDenseMatrix<T> transpose(const BasicDenseMatrix<T>& matrix); \
+    template BasicDenseMatrix<T> minor(const BasicDenseMatrix<T>& matrix, size_t n, size_t m); \
+    template double determinant(const BasicDenseMatrix<T>& matrix); \
+    template BasicDenseMatrix<T> inverse(const BasicDenseMatrix<T>& matrix); \
+    template BasicDenseMatrix<T> solve(const BasicDenseMatrix<T>& matrix, const BasicDenseMatrix<T>& b); \
+    template BasicDenseMatrix<T> lstsq(const BasicDenseMatrix<T>& matrix, const BasicDenseMatrix<T>& b); \
+    template BasicDenseMatrix<T> concatenate(const BasicDenseMatrix<T>& matrix1, \
+                                             const BasicDenseMatrix<T>& matrix2, int axis); \
+    template BasicDenseMatrix<T> ero_swap(const BasicDenseMatrix<T>& matrix, size_t r1, size_t r2); \
+    template BasicDenseMatrix<T> ero_multiply(const BasicDenseMatrix<T>& matrix, size_t r, double c); \
+    template BasicDenseMatrix<T> ero_sum(const BasicDenseMatrix<T>& matrix, size_t r1, double c, size_t r2); \
+    template BasicDenseMatrix<T> upper_triangular(const BasicDenseMatrix<T>& matrix); \
+    template void transpose_in_place(BasicDenseMatrix<T>& matrix); \
+    template void ero_swap_in_place(BasicDenseMatrix<T>& matrix, size_t r1, size_t r2); \
+    template void ero_multiply_in_place(BasicDenseMatrix<T>& matrix, size_t r, double c); \
+    template void ero_sum_in_place(BasicDenseMatrix<T>& matrix, size_t r1, double c, size_t r2); \
+    template std::vector<size_t> upper_triangular_in_place(BasicDenseMatrix<T>& matrix);
+
+    ALGEBRA_INSTANTIATE(float)
+    ALGEBRA_INSTANTIATE(double)
+#undef ALGEBRA_INSTANTIATE
 }
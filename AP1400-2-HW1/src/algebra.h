@@ -8,8 +8,24 @@
 
 #include <iostream>
 #include <vector>
-
-using Matrix = std::vector<std::vector<double>>;
+#include "batch.h"
+#include "cholesky.h"
+#include "dense_matrix.h"
+#include "dispatch.h"
+#include "eigen.h"
+#include "expression.h"
+#include "fixed_matrix.h"
+#include "lu.h"
+#include "matrix_io.h"
+#include "out_of_core.h"
+#include "philox.h"
+#include "qr.h"
+#include "sparse.h"
+#include "strassen.h"
+#include "svd.h"
+#include "thread_pool.h"
+#include "view.h"
+#include "workspace.h"
 
 // Some useful tools of algebra
 namespace algebra {
@@ -49,6 +65,12 @@ namespace algebra {
     // Return the matrix's inverse.
     Matrix inverse(const Matrix& matrix);
 
+    // Return the solution X of matrix * X = b, b has the right-hand sides as its columns.
+    Matrix solve(const Matrix& matrix, const Matrix& b);
+
+    // Return the least-squares solution X which minimizes |matrix * X - b|.
+    Matrix lstsq(const Matrix& matrix, const Matrix& b);
+
     // Return a new matrix that will concatenate given matrix1 and matrix2 along the given axis.
     Matrix concatenate(const Matrix& matrix1, const Matrix& matrix2, int axis=0);
 
@@ -61,8 +83,138 @@ namespace algebra {
     // Return a new matrix that sum adds r1th x c into r2th row.
     Matrix ero_sum(const Matrix& matrix, size_t r1, double c, size_t r2);
 
-    // Return a new matrix that calculates the upper triangular form of the matrix using the ERO operations.
+    // Return a new matrix that calculates the upper triangular form of the matrix by Gaussian elimination with
+    // partial pivoting, the rows are swapped to bring the largest element of each column onto the diagonal.
     Matrix upper_triangular(const Matrix& matrix);
+
+    // Transpose the square matrix in place.
+    void transpose_in_place(Matrix& matrix);
+
+    // The in-place versions of the ERO operations, they modify the given matrix instead of copying it.
+
+    // Swap r1th row with r2th.
+    void ero_swap_in_place(Matrix& matrix, size_t r1, size_t r2);
+
+    // Multiply every element in rth row with constant number c.
+    void ero_multiply_in_place(Matrix& matrix, size_t r, double c);
+
+    // Add r1th x c into r2th row.
+    void ero_sum_in_place(Matrix& matrix, size_t r1, double c, size_t r2);
+
+    // The overloads below work on the contiguous DenseMatrix, or DenseMatrixF for single precision,
+    // and follow the same rules as the Matrix ones. They are compiled for T = float and T = double.
+    // A zeros or ones matrix is created by the constructors directly.
+
+    // Fill the given matrix with random numbers between given min and max.
+    template <typename T>
+    void random(BasicDenseMatrix<T>& matrix, double min, double max);
+
+    // Display the matrix;
+    template <typename T>
+    void show(const BasicDenseMatrix<T>& matrix);
+
+    // Return a new matrix that multiplies the given matrix into the given constant scalar c
+    template <typename T>
+    BasicDenseMatrix<T> multiply(const BasicDenseMatrix<T>& matrix, double c);
+
+    // Return a new matrix that multiplies the given matrix1 into given matrix2.
+    template <typename T>
+    BasicDenseMatrix<T> multiply(const BasicDenseMatrix<T>& matrix1, const BasicDenseMatrix<T>& matrix2);
+
+    // Return a new matrix that multiplies the given float matrix1 into given matrix2, with all the products
+    // and sums done in double. Only the result is rounded to float, so it keeps the accuracy of a double
+    // product at the storage and bandwidth cost of a float one.
+    DenseMatrixF multiply_mixed(const DenseMatrixF& matrix1, const DenseMatrixF& matrix2);
+
+    // Return a new matrix that adds the constant number c to every element of given matrix.
+    template <typename T>
+    BasicDenseMatrix<T> sum(const BasicDenseMatrix<T>& matrix, double c);
+
+    // Return a new matrix that adds 2 matrices to each other.
+    template <typename T>
+    BasicDenseMatrix<T> sum(const BasicDenseMatrix<T>& matrix1, const BasicDenseMatrix<T>& matrix2);
+
+    // Return a transpose matrix of the input matrix.
+    template <typename T>
+    BasicDenseMatrix<T> transpose(const BasicDenseMatrix<T>& matrix);
+
+    // Return a new matrix of the minor of the input matrix with respect to nth row and mth column.
+    template <typename T>
+    BasicDenseMatrix<T> minor(const BasicDenseMatrix<T>& matrix, size_t n, size_t m);
+
+    // Return the calculation of the determinant of the input matrix.
+    // The factorization always runs in double.
+    template <typename T>
+    double determinant(const BasicDenseMatrix<T>& matrix);
+
+    // Return the matrix's inverse.
+    // The factorization always runs in double, the result is rounded to T.
+    template <typename T>
+    BasicDenseMatrix<T> inverse(const BasicDenseMatrix<T>& matrix);
+
+    // Return the solution X of matrix * X = b, b has the right-hand sides as its columns.
+    // The matrix is factorized by LU in double and the substitutions cost O(n^2) per right-hand side,
+    // keep an LU or a Cholesky to solve more systems with the same matrix.
+    // Throw logic_error if the matrix is not square, b does not fit or the matrix is singular.
+    template <typename T>
+    BasicDenseMatrix<T> solve(const BasicDenseMatrix<T>& matrix, const BasicDenseMatrix<T>& b);
+
+    // Return the solution x of matrix * x = b.
+    std::vector<double> solve(const DenseMatrix& matrix, const std::vector<double>& b);
+
+    // Return the least-squares solution X which minimizes |matrix * X - b|, b has the right-hand sides as its columns.
+    // The matrix is factorized by a blocked Householder QR in double, which does not square the condition number
+    // like inverse(transpose(A) * A) does. When the matrix is wide, the solution with the smallest norm is returned.
+    // Throw logic_error if b does not have as many rows as the matrix or the rank of the matrix is not full.
+    template <typename T>
+    BasicDenseMatrix<T> lstsq(const BasicDenseMatrix<T>& matrix, const BasicDenseMatrix<T>& b);
+
+    // Return the least-squares solution x which minimizes |matrix * x - b|.
+    std::vector<double> lstsq(const DenseMatrix& matrix, const std::vector<double>& b);
+
+    // Return a new matrix that will concatenate given matrix1 and matrix2 along the given axis.
+    template <typename T>
+    BasicDenseMatrix<T> concatenate(const BasicDenseMatrix<T>& matrix1, const BasicDenseMatrix<T>& matrix2,
+                                    int axis=0);
+
+    // Return the swap matrix that swaps r1th row with r2th.
+    template <typename T>
+    BasicDenseMatrix<T> ero_swap(const BasicDenseMatrix<T>& matrix, size_t r1, size_t r2);
+
+    // Return a new matrix that multiplies every element in rth row with constant number c.
+    template <typename T>
+    BasicDenseMatrix<T> ero_multiply(const BasicDenseMatrix<T>& matrix, size_t r, double c);
+
+    // Return a new matrix that sum adds r1th x c into r2th row.
+    template <typename T>
+    BasicDenseMatrix<T> ero_sum(const BasicDenseMatrix<T>& matrix, size_t r1, double c, size_t r2);
+
+    // Return a new matrix that calculates the upper triangular form of the matrix by Gaussian elimination with
+    // partial pivoting, the rows are swapped to bring the largest element of each column onto the diagonal.
+    template <typename T>
+    BasicDenseMatrix<T> upper_triangular(const BasicDenseMatrix<T>& matrix);
+
+    // Transpose the square matrix in place.
+    template <typename T>
+    void transpose_in_place(BasicDenseMatrix<T>& matrix);
+
+    // Swap r1th row with r2th in place.
+    template <typename T>
+    void ero_swap_in_place(BasicDenseMatrix<T>& matrix, size_t r1, size_t r2);
+
+    // Multiply every element in rth row with constant number c in place.
+    template <typename T>
+    void ero_multiply_in_place(BasicDenseMatrix<T>& matrix, size_t r, double c);
+
+    // Add r1th x c into r2th row in place.
+    template <typename T>
+    void ero_sum_in_place(BasicDenseMatrix<T>& matrix, size_t r1, double c, size_t r2);
+
+    // Reduce the square matrix to its upper triangular form in place by Gaussian elimination with partial pivoting,
+    // the trailing rows of each panel are updated in parallel.
+    // Return the permutation: row i of the result is eliminated from row permutation[i] of the input.
+    template <typename T>
+    std::vector<size_t> upper_triangular_in_place(BasicDenseMatrix<T>& matrix);
 }
 
 #endif //SRC_ALGEBRA_H
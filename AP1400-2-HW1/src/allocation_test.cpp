@@ -0,0 +1,104 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <gtest/gtest.h>
+#include "algebra.h"
+
+// The program replaces the global operator new to count its calls, which is why it is apart from the unit tests.
+static std::atomic<size_t> new_calls(0);
+
+void *operator new(size_t bytes) {
+    new_calls++;
+    if (void *p = std::malloc(bytes ? bytes : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+    std::free(p);
+}
+
+// Run the computation twice to warm it up, then check that the next runs neither call operator new
+// nor take memory from the system and give the same result.
+template <typename Func>
+static void expect_no_allocation(Func compute) {
+    double expected = compute();
+    compute();
+    for (int run = 0; run < 10; run++) {
+        size_t allocations = algebra::heap_allocations(), news = new_calls;
+        double result = compute();
+        EXPECT_EQ(algebra::heap_allocations(), allocations);
+        EXPECT_EQ(new_calls, news);
+        EXPECT_EQ(result, expected);
+    }
+}
+
+class AllocationTest : public ::testing::Test {
+protected:
+    // More threads than tasks in some jobs, so the tasks land on different workers from run to run.
+    void SetUp() override {
+        algebra::set_num_threads(8);
+        algebra::set_buffer_cache_limit(size_t(1) << 28);
+    }
+
+    void TearDown() override {
+        algebra::set_buffer_cache_limit(0);
+        algebra::set_num_threads(0);
+    }
+};
+
+TEST_F(AllocationTest, PIPELINE) {
+    // test case: products, a sum, the elimination and a Cholesky solve, the Strassen path included
+    size_t n = 600;
+    algebra::set_strassen_threshold(n);
+    algebra::DenseMatrix a(n, n), b(n, 40);
+    algebra::random(a, algebra::Distribution::uniform, -1, 1, 31);
+    algebra::random(b, algebra::Distribution::uniform, -1, 1, 32);
+    expect_no_allocation([&]() {
+        algebra::DenseMatrix spd = algebra::multiply(algebra::transpose(a), a);
+        spd = algebra::sum(spd, algebra::multiply(algebra::DenseMatrix(n, n, 1.0), 0.0));
+        for (size_t i{}; i < n; i++) spd(i, i) += n;
+        algebra::DenseMatrix upper = algebra::upper_triangular(spd);
+        return algebra::Cholesky(spd).solve(b)(0, 0) + upper(n - 1, n - 1);
+    });
+    algebra::set_strassen_threshold(algebra::strassen_threshold);
+}
+
+TEST_F(AllocationTest, SOLVERS) {
+    // test case: the factorizations, the pivots come from the buffer cache
+    algebra::DenseMatrix square(200, 200), rhs(200, 3);
+    algebra::random(square, algebra::Distribution::uniform, -1, 1, 33);
+    algebra::random(rhs, algebra::Distribution::uniform, -1, 1, 34);
+    for (size_t i{}; i < 200; i++) square(i, i) += 10;
+    expect_no_allocation([&]() {
+        return algebra::determinant(square) + algebra::inverse(square)(0, 0)
+               + algebra::solve(square, rhs)(0, 0) + algebra::lstsq(square, rhs)(0, 0);
+    });
+}
+
+TEST_F(AllocationTest, MIXED_PRECISION) {
+    // test case: the float product accumulated in double tiles
+    size_t n = 300;
+    algebra::DenseMatrixF a(n, n), b(n, n);
+    algebra::random(a, algebra::Distribution::uniform, -1, 1, 35);
+    algebra::random(b, algebra::Distribution::uniform, -1, 1, 36);
+    expect_no_allocation([&]() {
+        return static_cast<double>(algebra::multiply_mixed(a, b)(n - 1, 0));
+    });
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    int ret{RUN_ALL_TESTS()};
+    std::cout << (ret ? "FAILED" : "<<<SUCCESS>>>") << std::endl;
+    return ret;
+}
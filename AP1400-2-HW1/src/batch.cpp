@@ -0,0 +1,246 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include "batch.h"
+#include "thread_pool.h"
+#include "workspace.h"
+
+using std::logic_error;
+using std::vector;
+
+namespace algebra {
+    // The number of matrices handled by one task. The working copy of a chunk of 8*8 matrices fits in L2,
+    // and it is a multiple of the SIMD width so every chunk starts on an aligned lane.
+    static constexpr size_t batch_chunk = 128;
+
+    MatrixBatch::MatrixBatch() : _count(0), _rows(0), _cols(0) {}
+
+    MatrixBatch::MatrixBatch(size_t count, size_t rows, size_t cols)
+            : _count(count), _rows(rows), _cols(cols), _data(rows * cols, count) {}
+
+    size_t MatrixBatch::size() const {
+        return _count;
+    }
+
+    size_t MatrixBatch::rows() const {
+        return _rows;
+    }
+
+    size_t MatrixBatch::cols() const {
+        return _cols;
+    }
+
+    void MatrixBatch::set(size_t b, const DenseMatrix &matrix) {
+        if (matrix.rows() != _rows || matrix.cols() != _cols) throw logic_error("The matrix has the wrong shape.");
+        for (size_t i = 0; i < _rows; i++)
+            for (size_t j = 0; j < _cols; j++) (*this)(b, i, j) = matrix(i, j);
+    }
+
+    DenseMatrix MatrixBatch::get(size_t b) const {
+        DenseMatrix res(_rows, _cols);
+        for (size_t i = 0; i < _rows; i++)
+            for (size_t j = 0; j < _cols; j++) res(i, j) = (*this)(b, i, j);
+        return res;
+    }
+
+    // A helper function to run func(first, width) on the chunks of count matrices in parallel.
+    template <typename Func>
+    static void for_each_chunk(size_t count, Func func) {
+        thread_pool().parallel_for((count + batch_chunk - 1) / batch_chunk, [&](size_t chunk) {
+            size_t first = chunk * batch_chunk;
+            func(first, std::min(batch_chunk, count - first));
+        });
+    }
+
+    // The elimination works on a chunk of w matrices copied into a workspace where element e of
+    // matrix l is at e * w + l. Each matrix picks its own pivot, and the row exchanges are done with
+    // selects instead of branches, so every loop over l stays one straight SIMD loop.
+    namespace {
+        struct BatchWorkspace {
+            BatchWorkspace(const MatrixBatch &batch, size_t first, size_t w)
+                    : n(batch.rows()), w(w), a(n * n * w), pivot(w), best(w), scale(w), singular(w) {
+                std::fill(scale.data(), scale.data() + w, 0.0);
+                std::fill(singular.data(), singular.data() + w, 0.0);
+                for (size_t i = 0; i < n; i++)
+                    for (size_t j = 0; j < n; j++) {
+                        const double *src = batch.lane(i, j) + first;
+                        double *dst = at(i, j);
+                        for (size_t l = 0; l < w; l++) {
+                            dst[l] = src[l];
+                            scale[l] = std::max(scale[l], std::fabs(src[l]));
+                        }
+                    }
+                // The same negligible pivot test as the LU factorization.
+                for (size_t l = 0; l < w; l++) scale[l] *= n * std::numeric_limits<double>::epsilon();
+            }
+
+            // Return the lane of element (i, j).
+            double *at(size_t i, size_t j) { return a.data() + (i * n + j) * w; }
+
+            // Find the pivot row of column k for every matrix, at or below row k, and mark the singular ones.
+            // The row numbers are kept as doubles so they compare in the same SIMD loops as the elements.
+            void choose_pivot(size_t k) {
+                std::fill(pivot.data(), pivot.data() + w, static_cast<double>(k));
+                const double *col = at(k, k);
+                for (size_t l = 0; l < w; l++) best[l] = std::fabs(col[l]);
+                for (size_t i = k + 1; i < n; i++) {
+                    col = at(i, k);
+                    for (size_t l = 0; l < w; l++) {
+                        bool larger = std::fabs(col[l]) > best[l];
+                        best[l] = larger ? std::fabs(col[l]) : best[l];
+                        pivot[l] = larger ? static_cast<double>(i) : pivot[l];
+                    }
+                }
+                for (size_t l = 0; l < w; l++) singular[l] = best[l] <= scale[l] ? 1.0 : singular[l];
+            }
+
+            // Exchange the lanes x of row k and y of row i in the matrices whose pivot is row i.
+            void swap(double *x, double *y, size_t i) {
+                double row = static_cast<double>(i);
+                for (size_t l = 0; l < w; l++) {
+                    bool chosen = pivot[l] == row;
+                    double t = x[l];
+                    x[l] = chosen ? y[l] : t;
+                    y[l] = chosen ? t : y[l];
+                }
+            }
+
+            size_t n;
+            size_t w;
+            // The elements of the chunk, from the scratch stack of the thread which runs it.
+            Scratch<double> a;
+            // The pivot row and its absolute value of the current column.
+            Scratch<double> pivot;
+            Scratch<double> best;
+            // The negligible pivot bound, and 1 for the singular matrices.
+            Scratch<double> scale;
+            Scratch<double> singular;
+        };
+    }
+
+    MatrixBatch multiply_batch(const MatrixBatch &batch1, const MatrixBatch &batch2) {
+        if (batch1.size() != batch2.size()) throw logic_error("Both batches must have the same size.");
+        // Check for compatible dimensions for matrix multiplication.
+        if (batch1.cols() != batch2.rows())
+            throw logic_error("The number of columns in the first matrix must equal "
+                              "the number of rows in the second matrix.");
+        size_t m = batch1.rows(), n = batch2.cols(), k = batch1.cols();
+        MatrixBatch res(batch1.size(), m, n);
+        for_each_chunk(batch1.size(), [&](size_t first, size_t w) {
+            for (size_t i = 0; i < m; i++)
+                for (size_t j = 0; j < n; j++) {
+                    double *c = res.lane(i, j) + first;
+                    for (size_t p = 0; p < k; p++) {
+                        const double *a = batch1.lane(i, p) + first, *b = batch2.lane(p, j) + first;
+                        for (size_t l = 0; l < w; l++) c[l] += a[l] * b[l];
+                    }
+                }
+        });
+        return res;
+    }
+
+    std::vector<double> determinant_batch(const MatrixBatch &batch) {
+        if (batch.rows() != batch.cols()) throw logic_error("The matrix should be square.");
+        size_t n = batch.rows();
+        vector<double> res(batch.size(), 1.0);
+        for_each_chunk(batch.size(), [&](size_t first, size_t w) {
+            BatchWorkspace ws(batch, first, w);
+            double *det = res.data() + first;
+            Scratch<double> inv(w), magnitude(w), zero(w);
+            std::fill(zero.data(), zero.data() + w, 0.0);
+            double rounding = n * std::numeric_limits<double>::epsilon();
+            for (size_t k = 0; k < n; k++) {
+                ws.choose_pivot(k);
+                // The multipliers move with their rows, they are needed for the zero test below.
+                for (size_t i = k + 1; i < n; i++)
+                    for (size_t j = 0; j < n; j++) ws.swap(ws.at(k, j), ws.at(i, j), i);
+                // The same zero test as LU::determinant: a pivot is zero if it is within the rounding of
+                // the terms of (|L| * |U|)(k, k) it was cancelled from. The bound of singular() does not apply.
+                const double *pivot = ws.at(k, k);
+                for (size_t l = 0; l < w; l++) magnitude[l] = std::fabs(pivot[l]);
+                for (size_t i = 0; i < k; i++) {
+                    const double *lower = ws.at(k, i), *upper = ws.at(i, k);
+                    for (size_t l = 0; l < w; l++) magnitude[l] += std::fabs(lower[l] * upper[l]);
+                }
+                // Every exchange flips the sign, the singular matrices get an exact zero.
+                for (size_t l = 0; l < w; l++) {
+                    zero[l] = std::fabs(pivot[l]) <= rounding * magnitude[l] ? 1.0 : zero[l];
+                    det[l] *= ws.pivot[l] != static_cast<double>(k) ? -pivot[l] : pivot[l];
+                    det[l] = zero[l] != 0 ? 0.0 : det[l];
+                    inv[l] = pivot[l] == 0 ? 0.0 : 1 / pivot[l];
+                }
+                // Eliminate below the pivot.
+                for (size_t i = k + 1; i < n; i++) {
+                    double *row_i = ws.at(i, k);
+                    for (size_t l = 0; l < w; l++) row_i[l] *= inv[l];
+                    for (size_t j = k + 1; j < n; j++) {
+                        double *a = ws.at(i, j);
+                        const double *b = ws.at(k, j);
+                        for (size_t l = 0; l < w; l++) a[l] -= row_i[l] * b[l];
+                    }
+                }
+            }
+        });
+        return res;
+    }
+
+    MatrixBatch inverse_batch(const MatrixBatch &batch) {
+        if (batch.rows() != batch.cols()) throw logic_error("The matrix should be square.");
+        size_t n = batch.rows();
+        MatrixBatch res(batch.size(), n, n);
+        vector<char> singular(batch.size());
+        for_each_chunk(batch.size(), [&](size_t first, size_t w) {
+            // Gauss-Jordan elimination on [A | I], the right half is the result itself.
+            BatchWorkspace ws(batch, first, w);
+            for (size_t i = 0; i < n; i++) std::fill(res.lane(i, i) + first, res.lane(i, i) + first + w, 1.0);
+            Scratch<double> inv(w), f(w);
+            for (size_t k = 0; k < n; k++) {
+                ws.choose_pivot(k);
+                // The columns left of k are already eliminated in both rows, only the rest is exchanged.
+                for (size_t i = k + 1; i < n; i++) {
+                    for (size_t j = k; j < n; j++) ws.swap(ws.at(k, j), ws.at(i, j), i);
+                    for (size_t j = 0; j < n; j++) ws.swap(res.lane(k, j) + first, res.lane(i, j) + first, i);
+                }
+                // Scale the pivot row to get a unit pivot.
+                const double *pivot = ws.at(k, k);
+                for (size_t l = 0; l < w; l++) inv[l] = ws.singular[l] != 0 ? 0.0 : 1 / pivot[l];
+                for (size_t j = k; j < n; j++) {
+                    double *a = ws.at(k, j);
+                    for (size_t l = 0; l < w; l++) a[l] *= inv[l];
+                }
+                for (size_t j = 0; j < n; j++) {
+                    double *r = res.lane(k, j) + first;
+                    for (size_t l = 0; l < w; l++) r[l] *= inv[l];
+                }
+                // Eliminate column k from all the other rows.
+                for (size_t i = 0; i < n; i++) {
+                    if (i == k) continue;
+                    std::copy(ws.at(i, k), ws.at(i, k) + w, f.data());
+                    for (size_t j = k; j < n; j++) {
+                        double *a = ws.at(i, j);
+                        const double *b = ws.at(k, j);
+                        for (size_t l = 0; l < w; l++) a[l] -= f[l] * b[l];
+                    }
+                    for (size_t j = 0; j < n; j++) {
+                        double *a = res.lane(i, j) + first;
+                        const double *b = res.lane(k, j) + first;
+                        for (size_t l = 0; l < w; l++) a[l] -= f[l] * b[l];
+                    }
+                }
+            }
+            for (size_t l = 0; l < w; l++) singular[first + l] = ws.singular[l] != 0;
+        });
+        // Check if any matrix of the batch is singular.
+        auto it = std::find(singular.begin(), singular.end(), 1);
+        if (it != singular.end())
+            throw logic_error("Matrix " + std::to_string(it - singular.begin()) + " of the batch is not invertible.");
+        return res;
+    }
+}
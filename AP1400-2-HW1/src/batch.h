@@ -0,0 +1,66 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_BATCH_H
+#define SRC_BATCH_H
+
+#include <vector>
+#include "dense_matrix.h"
+
+namespace algebra {
+    // A batch of matrices of the same shape, stored as a structure of arrays:
+    // element (r, c) of all the matrices is one contiguous aligned lane, so the batched functions
+    // run the same operation on neighbour matrices with full SIMD vectors.
+    class MatrixBatch {
+    public:
+        // Default constructor that will create an empty batch.
+        MatrixBatch();
+
+        // Constructor that creates count rows*cols matrices with all elements equal to zero.
+        MatrixBatch(size_t count, size_t rows, size_t cols);
+
+        // Return the number of matrices.
+        size_t size() const;
+
+        // Return the shape of every matrix.
+        size_t rows() const;
+        size_t cols() const;
+
+        // Return the element at rth row and cth column of the bth matrix, no bound check.
+        double &operator()(size_t b, size_t r, size_t c) { return _data(r * _cols + c, b); }
+        double operator()(size_t b, size_t r, size_t c) const { return _data(r * _cols + c, b); }
+
+        // Return the lane of element (r, c), the size() values of all the matrices.
+        double *lane(size_t r, size_t c) { return _data.row(r * _cols + c); }
+        const double *lane(size_t r, size_t c) const { return _data.row(r * _cols + c); }
+
+        // Copy the bth matrix in or out of the batch.
+        // Throw logic_error if the shape is different.
+        void set(size_t b, const DenseMatrix &matrix);
+        DenseMatrix get(size_t b) const;
+
+    private:
+        size_t _count;
+        size_t _rows;
+        size_t _cols;
+        // One row per element of the matrices, one column per matrix.
+        DenseMatrix _data;
+    };
+
+    // Return the batch of the products of the matrices with the same index in batch1 and batch2.
+    // Throw logic_error if the sizes of the batches or the dimensions do not match.
+    MatrixBatch multiply_batch(const MatrixBatch &batch1, const MatrixBatch &batch2);
+
+    // Return the batch of the inverses of the square matrices.
+    // Throw logic_error if the matrices are not square, or if any of them is singular.
+    MatrixBatch inverse_batch(const MatrixBatch &batch);
+
+    // Return the determinants of the square matrices, zero when a pivot is zero up to the rounding of the
+    // elimination as in LU::determinant.
+    // Throw logic_error if the matrices are not square.
+    std::vector<double> determinant_batch(const MatrixBatch &batch);
+}
+
+#endif //SRC_BATCH_H
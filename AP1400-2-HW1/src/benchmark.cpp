@@ -0,0 +1,681 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "algebra.h"
+#include "transpose.h"
+
+// The naive i-j-k product, kept as the baseline the kernels are compared with.
+static Matrix multiply_naive(const Matrix& matrix1, const Matrix& matrix2) {
+    size_t rows = matrix1.size();
+    size_t cols = matrix2[0].size();
+    size_t inner = matrix1[0].size();
+    Matrix res(rows, std::vector<double>(cols));
+    for (size_t i = 0; i < rows; i++)
+        for (size_t j = 0; j < cols; j++)
+            for (size_t k = 0; k < inner; k++)
+                res[i][j] += matrix1[i][k] * matrix2[k][j];
+    return res;
+}
+
+// The push_back version of the scalar product, kept as the baseline of the element-wise kernels.
+static Matrix multiply_push_back(const Matrix& matrix, double c) {
+    Matrix res;
+    for (const auto& i : matrix) {
+        std::vector<double> v;
+        for (double j : i) v.push_back(j * c);
+        res.push_back(v);
+    }
+    return res;
+}
+
+// The push_back version of the matrix sum.
+static Matrix sum_push_back(const Matrix& matrix1, const Matrix& matrix2) {
+    Matrix res;
+    for (size_t i = 0; i < matrix1.size(); i++) {
+        std::vector<double> v;
+        for (size_t j = 0; j < matrix1[i].size(); j++) v.push_back(matrix1[i][j] + matrix2[i][j]);
+        res.push_back(v);
+    }
+    return res;
+}
+
+// Measure the loop in time stamp counter cycles, and report the bytes read and written per cycle.
+// The counter is x86 only, elsewhere the bytes per second of the run are reported alone.
+template <typename Func>
+static void run_per_cycle(benchmark::State& state, size_t bytes, Func func) {
+#if defined(__x86_64__) || defined(__i386__)
+    uint64_t cycles = 0;
+    for (auto _ : state) {
+        uint64_t start = __rdtsc();
+        func();
+        cycles += __rdtsc() - start;
+    }
+    state.counters["bytes/cycle"] = static_cast<double>(state.iterations() * bytes) / cycles;
+#else
+    for (auto _ : state) func();
+#endif
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+// Report the floating-point throughput of a n*n*n product.
+static void set_gflops(benchmark::State& state, size_t n) {
+    state.counters["GFLOP/s"] = benchmark::Counter(2.0 * n * n * n * state.iterations() / 1e9,
+                                                   benchmark::Counter::kIsRate);
+}
+
+static void BM_MultiplyNaive(benchmark::State& state) {
+    size_t n = state.range(0);
+    Matrix a{algebra::random(n, n, -1, 1)}, b{algebra::random(n, n, -1, 1)};
+    for (auto _ : state) benchmark::DoNotOptimize(multiply_naive(a, b));
+    set_gflops(state, n);
+}
+BENCHMARK(BM_MultiplyNaive)->RangeMultiplier(2)->Range(64, 1024)->Unit(benchmark::kMillisecond);
+
+static void BM_Multiply(benchmark::State& state) {
+    size_t n = state.range(0);
+    Matrix a{algebra::random(n, n, -1, 1)}, b{algebra::random(n, n, -1, 1)};
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply(a, b));
+    set_gflops(state, n);
+}
+BENCHMARK(BM_Multiply)->RangeMultiplier(2)->Range(64, 1024)->Unit(benchmark::kMillisecond);
+
+static void BM_MultiplyDense(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n), b(n, n);
+    algebra::random(a, -1, 1);
+    algebra::random(b, -1, 1);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply(a, b));
+    set_gflops(state, n);
+}
+BENCHMARK(BM_MultiplyDense)->RangeMultiplier(2)->Range(64, 1024)->Unit(benchmark::kMillisecond);
+
+static void BM_MultiplyFloat(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrixF a(n, n), b(n, n);
+    algebra::random(a, -1, 1);
+    algebra::random(b, -1, 1);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply(a, b));
+    set_gflops(state, n);
+}
+BENCHMARK(BM_MultiplyFloat)->RangeMultiplier(2)->Range(64, 1024)->Unit(benchmark::kMillisecond);
+
+static void BM_MultiplyMixed(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrixF a(n, n), b(n, n);
+    algebra::random(a, -1, 1);
+    algebra::random(b, -1, 1);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply_mixed(a, b));
+    set_gflops(state, n);
+}
+BENCHMARK(BM_MultiplyMixed)->RangeMultiplier(2)->Range(64, 1024)->Unit(benchmark::kMillisecond);
+
+static void BM_ScalePushBack(benchmark::State& state) {
+    size_t n = state.range(0);
+    Matrix a{algebra::random(n, n, -1, 1)};
+    run_per_cycle(state, 2 * n * n * sizeof(double), [&] { benchmark::DoNotOptimize(multiply_push_back(a, 1.5)); });
+}
+BENCHMARK(BM_ScalePushBack)->RangeMultiplier(4)->Range(64, 4096);
+
+static void BM_Scale(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n);
+    algebra::random(a, -1, 1);
+    run_per_cycle(state, 2 * n * n * sizeof(double), [&] { benchmark::DoNotOptimize(algebra::multiply(a, 1.5)); });
+}
+BENCHMARK(BM_Scale)->RangeMultiplier(4)->Range(64, 4096);
+
+static void BM_ScaleFloat(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrixF a(n, n);
+    algebra::random(a, -1, 1);
+    run_per_cycle(state, 2 * n * n * sizeof(float), [&] { benchmark::DoNotOptimize(algebra::multiply(a, 1.5)); });
+}
+BENCHMARK(BM_ScaleFloat)->RangeMultiplier(4)->Range(64, 4096);
+
+static void BM_Shift(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n);
+    algebra::random(a, -1, 1);
+    run_per_cycle(state, 2 * n * n * sizeof(double), [&] { benchmark::DoNotOptimize(algebra::sum(a, 1.5)); });
+}
+BENCHMARK(BM_Shift)->RangeMultiplier(4)->Range(64, 4096);
+
+static void BM_SumPushBack(benchmark::State& state) {
+    size_t n = state.range(0);
+    Matrix a{algebra::random(n, n, -1, 1)}, b{algebra::random(n, n, -1, 1)};
+    run_per_cycle(state, 3 * n * n * sizeof(double), [&] { benchmark::DoNotOptimize(sum_push_back(a, b)); });
+}
+BENCHMARK(BM_SumPushBack)->RangeMultiplier(4)->Range(64, 4096);
+
+static void BM_Sum(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n), b(n, n);
+    algebra::random(a, -1, 1);
+    algebra::random(b, -1, 1);
+    run_per_cycle(state, 3 * n * n * sizeof(double), [&] { benchmark::DoNotOptimize(algebra::sum(a, b)); });
+}
+BENCHMARK(BM_Sum)->RangeMultiplier(4)->Range(64, 4096);
+
+// The straight double loop of the transpose, kept as the baseline.
+static Matrix transpose_naive(const Matrix& matrix) {
+    Matrix res{matrix[0].size(), std::vector<double>(matrix.size())};
+    for (size_t i = 0; i < res.size(); i++)
+        for (size_t j = 0; j < res[i].size(); j++) res[i][j] = matrix[j][i];
+    return res;
+}
+
+static void BM_TransposeNaive(benchmark::State& state) {
+    size_t n = state.range(0);
+    Matrix a{algebra::random(n, n, -1, 1)};
+    for (auto _ : state) benchmark::DoNotOptimize(transpose_naive(a));
+    state.SetBytesProcessed(state.iterations() * 2 * n * n * sizeof(double));
+}
+BENCHMARK(BM_TransposeNaive)->RangeMultiplier(4)->Range(256, 4096)->Unit(benchmark::kMillisecond);
+
+static void BM_Transpose(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n);
+    algebra::random(a, -1, 1);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::transpose(a));
+    state.SetBytesProcessed(state.iterations() * 2 * n * n * sizeof(double));
+}
+BENCHMARK(BM_Transpose)->RangeMultiplier(4)->Range(256, 4096)->Unit(benchmark::kMillisecond);
+
+static void BM_TransposeKernel(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n), b(n, n);
+    algebra::random(a, -1, 1);
+    for (auto _ : state) {
+        algebra::kernel::transpose(n, n, a.data(), a.stride(), b.data(), b.stride());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * n * n * sizeof(double));
+}
+BENCHMARK(BM_TransposeKernel)->RangeMultiplier(4)->Range(256, 4096)->Unit(benchmark::kMillisecond);
+
+static void BM_TransposeInPlace(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n);
+    algebra::random(a, -1, 1);
+    for (auto _ : state) {
+        algebra::transpose_in_place(a);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * n * n * sizeof(double));
+}
+BENCHMARK(BM_TransposeInPlace)->RangeMultiplier(4)->Range(256, 4096)->Unit(benchmark::kMillisecond);
+
+static void BM_ScaledSum(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n), b(n, n);
+    algebra::random(a, -1, 1);
+    algebra::random(b, -1, 1);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(algebra::sum(algebra::multiply(a, 2.0), algebra::multiply(b, 3.0)));
+}
+BENCHMARK(BM_ScaledSum)->RangeMultiplier(4)->Range(64, 4096)->Unit(benchmark::kMicrosecond);
+
+static void BM_ScaledSumLazy(benchmark::State& state) {
+    using namespace algebra::expression;
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n), b(n, n);
+    algebra::random(a, -1, 1);
+    algebra::random(b, -1, 1);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(evaluate(lazy(a) * 2.0 + lazy(b) * 3.0));
+}
+BENCHMARK(BM_ScaledSumLazy)->RangeMultiplier(4)->Range(64, 4096)->Unit(benchmark::kMicrosecond);
+
+// Read a text dump back, the baseline the binary files are compared with.
+static void BM_LoadText(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n);
+    algebra::random(a, -1, 1);
+    std::string path = "bench_matrix.txt";
+    {
+        std::ofstream out(path);
+        out.precision(17);
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = 0; j < n; j++) out << a(i, j) << (j + 1 < n ? ' ' : '\n');
+    }
+    for (auto _ : state) {
+        std::ifstream in(path);
+        algebra::DenseMatrix b(n, n);
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = 0; j < n; j++) in >> b(i, j);
+        benchmark::DoNotOptimize(b.data());
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * sizeof(double));
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_LoadText)->RangeMultiplier(4)->Range(256, 1024)->Unit(benchmark::kMillisecond);
+
+// Map a binary file and touch every element, so the page faults are counted too.
+static void BM_Load(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n);
+    algebra::random(a, -1, 1);
+    std::string path = "bench_matrix.bin";
+    algebra::save(path, a);
+    for (auto _ : state) {
+        algebra::DenseMatrix b = algebra::load(path);
+        double total = 0;
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = 0; j < n; j++) total += b(i, j);
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * sizeof(double));
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_Load)->RangeMultiplier(4)->Range(256, 1024)->Unit(benchmark::kMillisecond);
+
+static void BM_Save(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n);
+    algebra::random(a, -1, 1);
+    std::string path = "bench_matrix.bin";
+    for (auto _ : state) algebra::save(path, a);
+    state.SetBytesProcessed(state.iterations() * n * n * sizeof(double));
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_Save)->RangeMultiplier(4)->Range(256, 1024)->Unit(benchmark::kMillisecond);
+
+// The product of two files with tiles of a budget of 8 MB, compare with BM_MultiplyDense.
+static void BM_MultiplyOutOfCore(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n), b(n, n);
+    algebra::random(a, -1, 1);
+    algebra::random(b, -1, 1);
+    algebra::save("bench_a.bin", a);
+    algebra::save("bench_b.bin", b);
+    for (auto _ : state) algebra::multiply_out_of_core("bench_a.bin", "bench_b.bin", "bench_c.bin", 8 << 20);
+    set_gflops(state, n);
+    std::remove("bench_a.bin");
+    std::remove("bench_b.bin");
+    std::remove("bench_c.bin");
+}
+BENCHMARK(BM_MultiplyOutOfCore)->RangeMultiplier(2)->Range(256, 2048)->Unit(benchmark::kMillisecond);
+
+// Chains of tiny products and inverses, the fixed-size matrices against the general functions.
+template <size_t N>
+static void BM_FixedMultiplyInverse(benchmark::State& state) {
+    algebra::DenseMatrix dense(N, N);
+    algebra::random(dense, 1, 2);
+    for (size_t i = 0; i < N; i++) dense(i, i) += N;
+    algebra::FixedMatrix<N, N> a(dense);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(algebra::inverse(algebra::multiply(a, a)));
+    }
+}
+BENCHMARK_TEMPLATE(BM_FixedMultiplyInverse, 3);
+BENCHMARK_TEMPLATE(BM_FixedMultiplyInverse, 4);
+BENCHMARK_TEMPLATE(BM_FixedMultiplyInverse, 8);
+
+template <size_t N>
+static void BM_MultiplyInverse(benchmark::State& state) {
+    Matrix a(N, std::vector<double>(N, 1.5));
+    for (size_t i = 0; i < N; i++) a[i][i] += N;
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::inverse(algebra::multiply(a, a)));
+}
+BENCHMARK_TEMPLATE(BM_MultiplyInverse, 3);
+BENCHMARK_TEMPLATE(BM_MultiplyInverse, 4);
+BENCHMARK_TEMPLATE(BM_MultiplyInverse, 8);
+
+// 100k 4*4 matrices, one call for the batch against a loop of single calls.
+static void BM_InverseLoop(benchmark::State& state) {
+    std::vector<algebra::DenseMatrix> matrices(100000, algebra::DenseMatrix(4, 4));
+    for (size_t b = 0; b < matrices.size(); b++) algebra::random(matrices[b], algebra::Distribution::uniform, 1, 2, b);
+    for (auto _ : state)
+        for (const auto& matrix : matrices) benchmark::DoNotOptimize(algebra::inverse(matrix));
+    state.SetItemsProcessed(state.iterations() * matrices.size());
+}
+BENCHMARK(BM_InverseLoop)->Unit(benchmark::kMillisecond);
+
+static void BM_InverseBatch(benchmark::State& state) {
+    algebra::MatrixBatch batch(100000, 4, 4);
+    algebra::DenseMatrix matrix(4, 4);
+    for (size_t b = 0; b < batch.size(); b++) {
+        algebra::random(matrix, algebra::Distribution::uniform, 1, 2, b);
+        batch.set(b, matrix);
+    }
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::inverse_batch(batch));
+    state.SetItemsProcessed(state.iterations() * batch.size());
+}
+BENCHMARK(BM_InverseBatch)->Unit(benchmark::kMillisecond);
+
+static void BM_MultiplyBatch(benchmark::State& state) {
+    algebra::MatrixBatch batch(100000, 4, 4);
+    for (size_t i = 0; i < 4; i++)
+        for (size_t j = 0; j < 4; j++) std::fill(batch.lane(i, j), batch.lane(i, j) + batch.size(), i + j);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply_batch(batch, batch));
+    state.SetItemsProcessed(state.iterations() * batch.size());
+}
+BENCHMARK(BM_MultiplyBatch)->Unit(benchmark::kMillisecond);
+
+static void BM_DeterminantBatch(benchmark::State& state) {
+    algebra::MatrixBatch batch(100000, 4, 4);
+    algebra::DenseMatrix matrix(4, 4);
+    for (size_t b = 0; b < batch.size(); b++) {
+        algebra::random(matrix, algebra::Distribution::uniform, 1, 2, b);
+        batch.set(b, matrix);
+    }
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::determinant_batch(batch));
+    state.SetItemsProcessed(state.iterations() * batch.size());
+}
+BENCHMARK(BM_DeterminantBatch)->Unit(benchmark::kMillisecond);
+
+// A n*n matrix with the given percentage of nonzeros at random places.
+static algebra::DenseMatrix random_sparse(size_t n, int percent) {
+    algebra::DenseMatrix a(n, n), mask(n, n);
+    algebra::random(a, -1, 1);
+    algebra::random(mask, 0, 100);
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j < n; j++)
+            if (mask(i, j) >= percent) a(i, j) = 0;
+    return a;
+}
+
+// The sparse product against the dense kernel over the density, to place the sparse threshold.
+static void BM_MultiplySparse(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::SparseMatrix a(random_sparse(n, state.range(1)));
+    algebra::DenseMatrix b(n, n);
+    algebra::random(b, -1, 1);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply(a, b));
+}
+BENCHMARK(BM_MultiplySparse)->ArgsProduct({{512}, {1, 5, 10, 20, 40}})->Unit(benchmark::kMillisecond);
+
+static void BM_MultiplyDenseOfSparse(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a = random_sparse(n, state.range(1)), b(n, n);
+    algebra::random(b, -1, 1);
+    algebra::set_sparse_threshold(0);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply(a, b));
+    algebra::set_sparse_threshold(algebra::sparse_threshold);
+}
+BENCHMARK(BM_MultiplyDenseOfSparse)->ArgsProduct({{512}, {1, 5, 10, 20, 40}})->Unit(benchmark::kMillisecond);
+
+static void BM_SpMV(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::SparseMatrix a(random_sparse(n, 1));
+    std::vector<double> x(n, 1.0);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply(a, x));
+    state.SetItemsProcessed(state.iterations() * a.nonzeros());
+}
+BENCHMARK(BM_SpMV)->RangeMultiplier(4)->Range(256, 4096);
+
+static void BM_MultiplyClassical(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n), b(n, n);
+    algebra::random(a, -1, 1);
+    algebra::random(b, -1, 1);
+    algebra::set_strassen_threshold(0);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply(a, b));
+    algebra::set_strassen_threshold(algebra::strassen_threshold);
+    set_gflops(state, n);
+}
+BENCHMARK(BM_MultiplyClassical)->Arg(1024)->Arg(1536)->Arg(2048)->Arg(3000)->Unit(benchmark::kMillisecond);
+
+// The rate counts the multiply-adds of the classical product, so the two benchmarks compare directly.
+static void BM_MultiplyStrassen(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n), b(n, n);
+    algebra::random(a, -1, 1);
+    algebra::random(b, -1, 1);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply_strassen(a, b));
+    set_gflops(state, n);
+}
+BENCHMARK(BM_MultiplyStrassen)->Arg(1024)->Arg(1536)->Arg(2048)->Arg(3000)->Unit(benchmark::kMillisecond);
+
+// The largest error of the float products relative to the largest element of the exact double product.
+static void BM_StrassenError(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrixF a(n, n), b(n, n);
+    algebra::random(a, -1, 1);
+    algebra::random(b, -1, 1);
+    algebra::DenseMatrix exact = algebra::multiply(algebra::DenseMatrix(a), algebra::DenseMatrix(b));
+    algebra::set_strassen_threshold(0);
+    algebra::DenseMatrixF classical = algebra::multiply(a, b);
+    algebra::set_strassen_threshold(algebra::strassen_threshold);
+    algebra::DenseMatrixF strassen;
+    for (auto _ : state) benchmark::DoNotOptimize(strassen = algebra::multiply_strassen(a, b));
+    double scale = 0, classical_error = 0, strassen_error = 0;
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            scale = std::max(scale, std::abs(exact(i, j)));
+            classical_error = std::max(classical_error, std::abs(classical(i, j) - exact(i, j)));
+            strassen_error = std::max(strassen_error, std::abs(strassen(i, j) - exact(i, j)));
+        }
+    }
+    state.counters["classical"] = classical_error / scale;
+    state.counters["strassen"] = strassen_error / scale;
+}
+BENCHMARK(BM_StrassenError)->Arg(1024)->Arg(2048)->Arg(3000)->Unit(benchmark::kMillisecond);
+
+// The rate counts the 2/3 n^3 flops of the elimination.
+static void BM_UpperTriangular(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n);
+    algebra::random(a, -1, 1);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::upper_triangular(a));
+    state.counters["GFLOP/s"] = benchmark::Counter(2.0 / 3 * n * n * n * state.iterations() / 1e9,
+                                                   benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_UpperTriangular)->RangeMultiplier(2)->Range(256, 2048)->Unit(benchmark::kMillisecond);
+
+static void BM_Determinant(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n);
+    algebra::random(a, -1, 1);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::determinant(a));
+}
+BENCHMARK(BM_Determinant)->RangeMultiplier(2)->Range(256, 2048)->Unit(benchmark::kMillisecond);
+
+// Solve a n*n system with 16 right-hand sides.
+static void BM_SolveByInverse(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n), b(n, 16);
+    algebra::random(a, -1, 1);
+    algebra::random(b, -1, 1);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply(algebra::inverse(a), b));
+}
+BENCHMARK(BM_SolveByInverse)->RangeMultiplier(4)->Range(64, 1024)->Unit(benchmark::kMillisecond);
+
+static void BM_Solve(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n), b(n, 16);
+    algebra::random(a, -1, 1);
+    algebra::random(b, -1, 1);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::solve(a, b));
+}
+BENCHMARK(BM_Solve)->RangeMultiplier(4)->Range(64, 1024)->Unit(benchmark::kMillisecond);
+
+static void BM_SolveCholesky(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n), b(n, 16);
+    algebra::random(a, -1, 1);
+    algebra::random(b, -1, 1);
+    algebra::DenseMatrix spd = algebra::multiply(algebra::transpose(a), a);
+    for (size_t i = 0; i < n; i++) spd(i, i) += n;
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::Cholesky(spd).solve(b));
+}
+BENCHMARK(BM_SolveCholesky)->RangeMultiplier(4)->Range(64, 1024)->Unit(benchmark::kMillisecond);
+
+// Only the substitutions, the factorization is done once.
+static void BM_SolveFactored(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n), b(n, 16);
+    algebra::random(a, -1, 1);
+    algebra::random(b, -1, 1);
+    algebra::LU factorization(a);
+    for (auto _ : state) benchmark::DoNotOptimize(factorization.solve(b));
+}
+BENCHMARK(BM_SolveFactored)->RangeMultiplier(4)->Range(64, 1024)->Unit(benchmark::kMillisecond);
+
+// The second argument computes the eigenvectors too.
+static void BM_EigenSymmetric(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n);
+    algebra::random(a, -1, 1);
+    algebra::DenseMatrix symmetric = algebra::sum(a, algebra::transpose(a));
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::eigen_symmetric(symmetric, state.range(1)));
+}
+BENCHMARK(BM_EigenSymmetric)->ArgsProduct({{128, 512, 1024}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+// Square, then tall-skinny m*64 inputs.
+static void BM_SVD(benchmark::State& state) {
+    algebra::DenseMatrix a(state.range(0), state.range(1));
+    algebra::random(a, -1, 1);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::svd(a));
+}
+BENCHMARK(BM_SVD)->Args({128, 128})->Args({512, 512})->Args({10000, 64})->Args({100000, 64})
+        ->Unit(benchmark::kMillisecond);
+
+// Least squares on tall-skinny m*64 systems with 4 right-hand sides, against the normal equations.
+static void BM_LstsqNormalEquations(benchmark::State& state) {
+    algebra::DenseMatrix a(state.range(0), 64), b(state.range(0), 4);
+    algebra::random(a, -1, 1);
+    algebra::random(b, -1, 1);
+    for (auto _ : state) {
+        algebra::DenseMatrix at = algebra::transpose(a);
+        benchmark::DoNotOptimize(algebra::multiply(algebra::inverse(algebra::multiply(at, a)),
+                                                   algebra::multiply(at, b)));
+    }
+}
+BENCHMARK(BM_LstsqNormalEquations)->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+static void BM_Lstsq(benchmark::State& state) {
+    algebra::DenseMatrix a(state.range(0), 64), b(state.range(0), 4);
+    algebra::random(a, -1, 1);
+    algebra::random(b, -1, 1);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::lstsq(a, b));
+    state.counters["GFLOP/s"] = benchmark::Counter(2.0 * state.range(0) * 64 * 64 * state.iterations() / 1e9,
+                                                   benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_Lstsq)->Arg(10000)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+// The rate counts the 4/3 n^3 flops of a square factorization.
+static void BM_QR(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n);
+    algebra::random(a, -1, 1);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::qr(a));
+    state.counters["GFLOP/s"] = benchmark::Counter(4.0 / 3 * n * n * n * state.iterations() / 1e9,
+                                                   benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_QR)->RangeMultiplier(4)->Range(64, 1024)->Unit(benchmark::kMillisecond);
+
+// A chain of small products and sums, the second argument turns the buffer cache on.
+// The counter is the number of blocks taken from the system per iteration.
+static void BM_TemporariesChain(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::set_buffer_cache_limit(state.range(1) ? size_t(1) << 24 : 0);
+    algebra::DenseMatrix a(n, n), b(n, n);
+    algebra::random(a, -1, 1);
+    algebra::random(b, -1, 1);
+    size_t allocations = algebra::heap_allocations();
+    for (auto _ : state) {
+        algebra::DenseMatrix c = algebra::sum(algebra::multiply(a, b), algebra::transpose(a));
+        benchmark::DoNotOptimize(algebra::multiply(algebra::upper_triangular(c), 0.5));
+    }
+    state.counters["allocations"] = double(algebra::heap_allocations() - allocations) / state.iterations();
+    algebra::set_buffer_cache_limit(0);
+}
+BENCHMARK(BM_TemporariesChain)->ArgsProduct({{8, 32, 128}, {0, 1}});
+
+// The hot kernels in each variant of dispatch.h, the second argument is the variant.
+// The variant is pinned for the lifetime of the object, a variant the CPU cannot run skips the benchmark.
+class PinIsa {
+public:
+    explicit PinIsa(benchmark::State& state) : _previous(algebra::get_isa()) {
+        auto isa = static_cast<algebra::Isa>(state.range(1));
+        supported = algebra::isa_supported(isa);
+        if (!supported) {
+            state.SkipWithError("The instruction set is not supported.");
+            return;
+        }
+        algebra::set_isa(isa);
+        state.SetLabel(algebra::isa_name(isa));
+    }
+
+    ~PinIsa() { algebra::set_isa(_previous); }
+
+    bool supported;
+
+private:
+    algebra::Isa _previous;
+};
+
+static void BM_MultiplyIsa(benchmark::State& state) {
+    PinIsa pin(state);
+    if (!pin.supported) return;
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n), b(n, n);
+    algebra::random(a, -1, 1);
+    algebra::random(b, -1, 1);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply(a, b));
+    set_gflops(state, n);
+}
+BENCHMARK(BM_MultiplyIsa)->ArgsProduct({{256, 1024}, {0, 1, 2}})->Unit(benchmark::kMillisecond);
+
+static void BM_MultiplyFloatIsa(benchmark::State& state) {
+    PinIsa pin(state);
+    if (!pin.supported) return;
+    size_t n = state.range(0);
+    algebra::DenseMatrixF a(n, n), b(n, n);
+    algebra::random(a, -1, 1);
+    algebra::random(b, -1, 1);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply(a, b));
+    set_gflops(state, n);
+}
+BENCHMARK(BM_MultiplyFloatIsa)->ArgsProduct({{256, 1024}, {0, 1, 2}})->Unit(benchmark::kMillisecond);
+
+static void BM_SumIsa(benchmark::State& state) {
+    PinIsa pin(state);
+    if (!pin.supported) return;
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n), b(n, n);
+    algebra::random(a, -1, 1);
+    algebra::random(b, -1, 1);
+    run_per_cycle(state, 3 * n * n * sizeof(double), [&] { benchmark::DoNotOptimize(algebra::sum(a, b)); });
+}
+BENCHMARK(BM_SumIsa)->ArgsProduct({{64, 1024}, {0, 1, 2}});
+
+static void BM_TransposeIsa(benchmark::State& state) {
+    PinIsa pin(state);
+    if (!pin.supported) return;
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n), b(n, n);
+    algebra::random(a, -1, 1);
+    for (auto _ : state) {
+        algebra::kernel::transpose(n, n, a.data(), a.stride(), b.data(), b.stride());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * n * n * sizeof(double));
+}
+BENCHMARK(BM_TransposeIsa)->ArgsProduct({{256, 4096}, {0, 1, 2}})->Unit(benchmark::kMillisecond);
+
+static void BM_UpperTriangularIsa(benchmark::State& state) {
+    PinIsa pin(state);
+    if (!pin.supported) return;
+    size_t n = state.range(0);
+    algebra::DenseMatrix a(n, n);
+    algebra::random(a, -1, 1);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::upper_triangular(a));
+    state.counters["GFLOP/s"] = benchmark::Counter(2.0 / 3 * n * n * n * state.iterations() / 1e9,
+                                                   benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_UpperTriangularIsa)->ArgsProduct({{256, 1024}, {0, 1, 2}})->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
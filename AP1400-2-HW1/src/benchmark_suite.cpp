@@ -0,0 +1,718 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+// The regression suite: one benchmark per public algebra function and matrix type, on n*n operands from 4 to 4096.
+// The batches run over their number of 4*4 matrices, the fixed-size matrices over their size, the files stop
+// at 1024, and the sparse operands have 1% of nonzeros. Unlike benchmark.cpp, which compares the kernels with
+// their baselines, it only tracks the public functions, so two runs of it can be compared by compare_benchmarks.py.
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <iostream>
+#include <streambuf>
+#include "algebra.h"
+
+using algebra::DenseMatrix;
+
+// The sizes of every benchmark: 4, 16, 64, 256, 1024 and 4096.
+static void sizes(benchmark::internal::Benchmark* b) {
+    for (int n = 4; n <= 4096; n *= 4) b->Arg(n);
+    b->Unit(benchmark::kMicrosecond);
+}
+
+// The same sizes along both axes of concatenate.
+static void axes(benchmark::internal::Benchmark* b) {
+    for (int n = 4; n <= 4096; n *= 4) b->Args({n, 0})->Args({n, 1});
+    b->Unit(benchmark::kMicrosecond);
+}
+
+// The files stop at 1024, an operand of 4096 is 128 MB on disk.
+static void file_sizes(benchmark::internal::Benchmark* b) {
+    for (int n = 4; n <= 1024; n *= 4) b->Arg(n);
+    b->Unit(benchmark::kMicrosecond);
+}
+
+// The number of 4*4 matrices of a batch, from 16 to 65536.
+static void batch_sizes(benchmark::internal::Benchmark* b) {
+    for (int count = 16; count <= 65536; count *= 4) b->Arg(count);
+    b->Unit(benchmark::kMicrosecond);
+}
+
+// The iterative decompositions stop at 1024, their vectors cost about ten products at 4096.
+static void iterative_sizes(benchmark::internal::Benchmark* b) {
+    for (int n = 4; n <= 1024; n *= 4) b->Arg(n);
+    b->Unit(benchmark::kMicrosecond);
+}
+
+// Return a rows*cols operand with random elements in [-1, 1].
+template <typename M>
+static M operand(size_t rows, size_t cols);
+
+template <>
+Matrix operand<Matrix>(size_t rows, size_t cols) {
+    return algebra::random(rows, cols, -1, 1);
+}
+
+template <>
+DenseMatrix operand<DenseMatrix>(size_t rows, size_t cols) {
+    DenseMatrix res(rows, cols);
+    algebra::random(res, -1, 1);
+    return res;
+}
+
+static double& at(Matrix& matrix, size_t i, size_t j) {
+    return matrix[i][j];
+}
+
+static double& at(DenseMatrix& matrix, size_t i, size_t j) {
+    return matrix(i, j);
+}
+
+// Return a n*n operand with a dominant diagonal, so it is far from singular at every size.
+template <typename M>
+static M invertible(size_t n) {
+    M res = operand<M>(n, n);
+    for (size_t i = 0; i < n; i++) at(res, i, i) += n;
+    return res;
+}
+
+// Return a batch of count 4*4 matrices with a dominant diagonal.
+static algebra::MatrixBatch batch_operand(size_t count) {
+    algebra::MatrixBatch res(count, 4, 4);
+    for (size_t b = 0; b < count; b++) res.set(b, invertible<DenseMatrix>(4));
+    return res;
+}
+
+// Return a n*n sparse operand with about 1% of nonzeros, at least one per row.
+static algebra::SparseMatrix sparse_operand(size_t n) {
+    DenseMatrix res(n, n), mask(n, n);
+    algebra::random(res, -1, 1);
+    algebra::random(mask, 0, 100);
+    for (size_t i = 0; i < n; i++)
+        for (size_t j = 0; j < n; j++)
+            if (mask(i, j) >= 1 && j != i) res(i, j) = 0;
+    return algebra::SparseMatrix(res);
+}
+
+// A stream buffer which drops everything, so show is measured without the terminal.
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+};
+
+static void BM_Zeros(benchmark::State& state) {
+    size_t n = state.range(0);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::zeros(n, n));
+}
+BENCHMARK(BM_Zeros)->Apply(sizes);
+
+static void BM_Ones(benchmark::State& state) {
+    size_t n = state.range(0);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::ones(n, n));
+}
+BENCHMARK(BM_Ones)->Apply(sizes);
+
+static void BM_RandomMatrix(benchmark::State& state) {
+    size_t n = state.range(0);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::random(n, n, -1, 1));
+}
+BENCHMARK(BM_RandomMatrix)->Apply(sizes);
+
+static void BM_RandomDense(benchmark::State& state) {
+    size_t n = state.range(0);
+    DenseMatrix matrix(n, n);
+    for (auto _ : state) {
+        algebra::random(matrix, -1, 1);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_RandomDense)->Apply(sizes);
+
+template <typename M>
+static void BM_Show(benchmark::State& state) {
+    size_t n = state.range(0);
+    M matrix = operand<M>(n, n);
+    NullBuffer sink;
+    std::streambuf* old = std::cout.rdbuf(&sink);
+    for (auto _ : state) algebra::show(matrix);
+    std::cout.rdbuf(old);
+}
+BENCHMARK_TEMPLATE(BM_Show, Matrix)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Show, DenseMatrix)->Apply(sizes);
+
+template <typename M>
+static void BM_MultiplyScalar(benchmark::State& state) {
+    size_t n = state.range(0);
+    M matrix = operand<M>(n, n);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply(matrix, 1.5));
+}
+BENCHMARK_TEMPLATE(BM_MultiplyScalar, Matrix)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_MultiplyScalar, DenseMatrix)->Apply(sizes);
+
+template <typename M>
+static void BM_Multiply(benchmark::State& state) {
+    size_t n = state.range(0);
+    M matrix1 = operand<M>(n, n), matrix2 = operand<M>(n, n);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply(matrix1, matrix2));
+}
+BENCHMARK_TEMPLATE(BM_Multiply, Matrix)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Multiply, DenseMatrix)->Apply(sizes);
+
+static void BM_MultiplyMixed(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::DenseMatrixF matrix1(operand<DenseMatrix>(n, n)), matrix2(operand<DenseMatrix>(n, n));
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply_mixed(matrix1, matrix2));
+}
+BENCHMARK(BM_MultiplyMixed)->Apply(sizes);
+
+template <typename M>
+static void BM_SumScalar(benchmark::State& state) {
+    size_t n = state.range(0);
+    M matrix = operand<M>(n, n);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::sum(matrix, 1.5));
+}
+BENCHMARK_TEMPLATE(BM_SumScalar, Matrix)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_SumScalar, DenseMatrix)->Apply(sizes);
+
+template <typename M>
+static void BM_Sum(benchmark::State& state) {
+    size_t n = state.range(0);
+    M matrix1 = operand<M>(n, n), matrix2 = operand<M>(n, n);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::sum(matrix1, matrix2));
+}
+BENCHMARK_TEMPLATE(BM_Sum, Matrix)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Sum, DenseMatrix)->Apply(sizes);
+
+template <typename M>
+static void BM_Transpose(benchmark::State& state) {
+    size_t n = state.range(0);
+    M matrix = operand<M>(n, n);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::transpose(matrix));
+}
+BENCHMARK_TEMPLATE(BM_Transpose, Matrix)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Transpose, DenseMatrix)->Apply(sizes);
+
+template <typename M>
+static void BM_Minor(benchmark::State& state) {
+    size_t n = state.range(0);
+    M matrix = operand<M>(n, n);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::minor(matrix, n / 2, n / 2));
+}
+BENCHMARK_TEMPLATE(BM_Minor, Matrix)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Minor, DenseMatrix)->Apply(sizes);
+
+template <typename M>
+static void BM_Determinant(benchmark::State& state) {
+    size_t n = state.range(0);
+    M matrix = invertible<M>(n);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::determinant(matrix));
+}
+BENCHMARK_TEMPLATE(BM_Determinant, Matrix)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Determinant, DenseMatrix)->Apply(sizes);
+
+template <typename M>
+static void BM_Inverse(benchmark::State& state) {
+    size_t n = state.range(0);
+    M matrix = invertible<M>(n);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::inverse(matrix));
+}
+BENCHMARK_TEMPLATE(BM_Inverse, Matrix)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Inverse, DenseMatrix)->Apply(sizes);
+
+// One right-hand side.
+template <typename M>
+static void BM_Solve(benchmark::State& state) {
+    size_t n = state.range(0);
+    M matrix = invertible<M>(n), b = operand<M>(n, 1);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::solve(matrix, b));
+}
+BENCHMARK_TEMPLATE(BM_Solve, Matrix)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Solve, DenseMatrix)->Apply(sizes);
+
+// A n*(n/4) system with one right-hand side.
+template <typename M>
+static void BM_Lstsq(benchmark::State& state) {
+    size_t n = state.range(0);
+    M matrix = operand<M>(n, n / 4), b = operand<M>(n, 1);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::lstsq(matrix, b));
+}
+BENCHMARK_TEMPLATE(BM_Lstsq, Matrix)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_Lstsq, DenseMatrix)->Apply(sizes);
+
+static void BM_LU(benchmark::State& state) {
+    size_t n = state.range(0);
+    DenseMatrix matrix = invertible<DenseMatrix>(n);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::lu(matrix));
+}
+BENCHMARK(BM_LU)->Apply(sizes);
+
+static void BM_Cholesky(benchmark::State& state) {
+    size_t n = state.range(0);
+    DenseMatrix matrix = invertible<DenseMatrix>(n);
+    // Symmetric with a dominant positive diagonal, so positive definite.
+    matrix = algebra::sum(matrix, algebra::transpose(matrix));
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::cholesky(matrix));
+}
+BENCHMARK(BM_Cholesky)->Apply(sizes);
+
+static void BM_QR(benchmark::State& state) {
+    size_t n = state.range(0);
+    DenseMatrix matrix = operand<DenseMatrix>(n, n);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::qr(matrix));
+}
+BENCHMARK(BM_QR)->Apply(sizes);
+
+static void BM_EigenSymmetric(benchmark::State& state) {
+    size_t n = state.range(0);
+    DenseMatrix matrix = operand<DenseMatrix>(n, n);
+    matrix = algebra::sum(matrix, algebra::transpose(matrix));
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::eigen_symmetric(matrix));
+}
+BENCHMARK(BM_EigenSymmetric)->Apply(iterative_sizes);
+
+static void BM_SVD(benchmark::State& state) {
+    size_t n = state.range(0);
+    DenseMatrix matrix = operand<DenseMatrix>(n, n);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::svd(matrix));
+}
+BENCHMARK(BM_SVD)->Apply(iterative_sizes);
+
+// The second argument is the axis.
+template <typename M>
+static void BM_Concatenate(benchmark::State& state) {
+    size_t n = state.range(0);
+    M matrix1 = operand<M>(n, n), matrix2 = operand<M>(n, n);
+    int axis = static_cast<int>(state.range(1));
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::concatenate(matrix1, matrix2, axis));
+}
+BENCHMARK_TEMPLATE(BM_Concatenate, Matrix)->Apply(axes);
+BENCHMARK_TEMPLATE(BM_Concatenate, DenseMatrix)->Apply(axes);
+
+template <typename M>
+static void BM_EroSwap(benchmark::State& state) {
+    size_t n = state.range(0);
+    M matrix = operand<M>(n, n);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::ero_swap(matrix, 0, n - 1));
+}
+BENCHMARK_TEMPLATE(BM_EroSwap, Matrix)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_EroSwap, DenseMatrix)->Apply(sizes);
+
+template <typename M>
+static void BM_EroMultiply(benchmark::State& state) {
+    size_t n = state.range(0);
+    M matrix = operand<M>(n, n);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::ero_multiply(matrix, n / 2, 1.5));
+}
+BENCHMARK_TEMPLATE(BM_EroMultiply, Matrix)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_EroMultiply, DenseMatrix)->Apply(sizes);
+
+template <typename M>
+static void BM_EroSum(benchmark::State& state) {
+    size_t n = state.range(0);
+    M matrix = operand<M>(n, n);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::ero_sum(matrix, 0, 1.5, n - 1));
+}
+BENCHMARK_TEMPLATE(BM_EroSum, Matrix)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_EroSum, DenseMatrix)->Apply(sizes);
+
+template <typename M>
+static void BM_UpperTriangular(benchmark::State& state) {
+    size_t n = state.range(0);
+    M matrix = invertible<M>(n);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::upper_triangular(matrix));
+}
+BENCHMARK_TEMPLATE(BM_UpperTriangular, Matrix)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_UpperTriangular, DenseMatrix)->Apply(sizes);
+
+// The in-place functions run on the same matrix again and again, a transpose or a swap twice is the identity.
+template <typename M>
+static void BM_TransposeInPlace(benchmark::State& state) {
+    size_t n = state.range(0);
+    M matrix = operand<M>(n, n);
+    for (auto _ : state) {
+        algebra::transpose_in_place(matrix);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK_TEMPLATE(BM_TransposeInPlace, Matrix)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_TransposeInPlace, DenseMatrix)->Apply(sizes);
+
+template <typename M>
+static void BM_EroSwapInPlace(benchmark::State& state) {
+    size_t n = state.range(0);
+    M matrix = operand<M>(n, n);
+    for (auto _ : state) {
+        algebra::ero_swap_in_place(matrix, 0, n - 1);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK_TEMPLATE(BM_EroSwapInPlace, Matrix)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_EroSwapInPlace, DenseMatrix)->Apply(sizes);
+
+// The factor and its inverse alternate, so the row neither overflows nor vanishes.
+template <typename M>
+static void BM_EroMultiplyInPlace(benchmark::State& state) {
+    size_t n = state.range(0);
+    M matrix = operand<M>(n, n);
+    double c = 2;
+    for (auto _ : state) {
+        algebra::ero_multiply_in_place(matrix, n / 2, c);
+        c = 1 / c;
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK_TEMPLATE(BM_EroMultiplyInPlace, Matrix)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_EroMultiplyInPlace, DenseMatrix)->Apply(sizes);
+
+template <typename M>
+static void BM_EroSumInPlace(benchmark::State& state) {
+    size_t n = state.range(0);
+    M matrix = operand<M>(n, n);
+    double c = 1;
+    for (auto _ : state) {
+        algebra::ero_sum_in_place(matrix, 0, c, n - 1);
+        c = -c;
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK_TEMPLATE(BM_EroSumInPlace, Matrix)->Apply(sizes);
+BENCHMARK_TEMPLATE(BM_EroSumInPlace, DenseMatrix)->Apply(sizes);
+
+// The seeded generator, the second argument is the distribution: 0 for uniform, 1 for normal.
+static void BM_RandomSeeded(benchmark::State& state) {
+    size_t n = state.range(0);
+    auto distribution = state.range(1) ? algebra::Distribution::normal : algebra::Distribution::uniform;
+    DenseMatrix matrix(n, n);
+    uint64_t seed = 0;
+    for (auto _ : state) {
+        algebra::random(matrix, distribution, 0, 1, seed++);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_RandomSeeded)->Apply(axes);
+
+static void BM_MultiplyStrassen(benchmark::State& state) {
+    size_t n = state.range(0);
+    DenseMatrix matrix1 = operand<DenseMatrix>(n, n), matrix2 = operand<DenseMatrix>(n, n);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply_strassen(matrix1, matrix2));
+}
+BENCHMARK(BM_MultiplyStrassen)->Apply(sizes);
+
+// The expression templates, a scaled and shifted sum with a transpose in one fused loop.
+static void BM_Evaluate(benchmark::State& state) {
+    using namespace algebra::expression;
+    size_t n = state.range(0);
+    DenseMatrix matrix1 = operand<DenseMatrix>(n, n), matrix2 = operand<DenseMatrix>(n, n);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(evaluate(lazy(matrix1) * 1.5 + transpose(lazy(matrix2)) + 1.0));
+}
+BENCHMARK(BM_Evaluate)->Apply(sizes);
+
+// The views of a n*n matrix. Taking a view copies nothing, the functions on a view do the work.
+static void BM_SubmatrixView(benchmark::State& state) {
+    size_t n = state.range(0);
+    DenseMatrix matrix = operand<DenseMatrix>(n, n);
+    algebra::View view(matrix);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::submatrix(view, n / 4, n / 4, n / 2, n / 2));
+}
+BENCHMARK(BM_SubmatrixView)->Apply(sizes);
+
+static void BM_MinorView(benchmark::State& state) {
+    size_t n = state.range(0);
+    DenseMatrix matrix = operand<DenseMatrix>(n, n);
+    algebra::View view(matrix);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::minor(view, n / 2, n / 2));
+}
+BENCHMARK(BM_MinorView)->Apply(sizes);
+
+static void BM_ConcatenateView(benchmark::State& state) {
+    size_t n = state.range(0);
+    DenseMatrix matrix1 = operand<DenseMatrix>(n, n), matrix2 = operand<DenseMatrix>(n, n);
+    algebra::View view1(matrix1), view2(matrix2);
+    int axis = static_cast<int>(state.range(1));
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::concatenate(view1, view2, axis));
+}
+BENCHMARK(BM_ConcatenateView)->Apply(axes);
+
+// The functions on the minor of a (n+1)*(n+1) matrix, a view of two blocks per row.
+static void BM_MultiplyScalarView(benchmark::State& state) {
+    size_t n = state.range(0);
+    DenseMatrix matrix = operand<DenseMatrix>(n + 1, n + 1);
+    algebra::View view = algebra::minor(algebra::View(matrix), n / 2, n / 2);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply(view, 1.5));
+}
+BENCHMARK(BM_MultiplyScalarView)->Apply(sizes);
+
+static void BM_MultiplyView(benchmark::State& state) {
+    size_t n = state.range(0);
+    DenseMatrix matrix = operand<DenseMatrix>(n + 1, n + 1);
+    algebra::View view = algebra::minor(algebra::View(matrix), n / 2, n / 2);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply(view, view));
+}
+BENCHMARK(BM_MultiplyView)->Apply(sizes);
+
+static void BM_SumScalarView(benchmark::State& state) {
+    size_t n = state.range(0);
+    DenseMatrix matrix = operand<DenseMatrix>(n + 1, n + 1);
+    algebra::View view = algebra::minor(algebra::View(matrix), n / 2, n / 2);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::sum(view, 1.5));
+}
+BENCHMARK(BM_SumScalarView)->Apply(sizes);
+
+static void BM_SumView(benchmark::State& state) {
+    size_t n = state.range(0);
+    DenseMatrix matrix = operand<DenseMatrix>(n + 1, n + 1);
+    algebra::View view = algebra::minor(algebra::View(matrix), n / 2, n / 2);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::sum(view, view));
+}
+BENCHMARK(BM_SumView)->Apply(sizes);
+
+static void BM_TransposeView(benchmark::State& state) {
+    size_t n = state.range(0);
+    DenseMatrix matrix = operand<DenseMatrix>(n + 1, n + 1);
+    algebra::View view = algebra::minor(algebra::View(matrix), n / 2, n / 2);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::transpose(view));
+}
+BENCHMARK(BM_TransposeView)->Apply(sizes);
+
+static void BM_DeterminantView(benchmark::State& state) {
+    size_t n = state.range(0);
+    DenseMatrix matrix = invertible<DenseMatrix>(n + 1);
+    algebra::View view = algebra::minor(algebra::View(matrix), n / 2, n / 2);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::determinant(view));
+}
+BENCHMARK(BM_DeterminantView)->Apply(sizes);
+
+static void BM_InverseView(benchmark::State& state) {
+    size_t n = state.range(0);
+    DenseMatrix matrix = invertible<DenseMatrix>(n + 1);
+    algebra::View view = algebra::minor(algebra::View(matrix), n / 2, n / 2);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::inverse(view));
+}
+BENCHMARK(BM_InverseView)->Apply(sizes);
+
+static void BM_UpperTriangularView(benchmark::State& state) {
+    size_t n = state.range(0);
+    DenseMatrix matrix = invertible<DenseMatrix>(n + 1);
+    algebra::View view = algebra::minor(algebra::View(matrix), n / 2, n / 2);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::upper_triangular(view));
+}
+BENCHMARK(BM_UpperTriangularView)->Apply(sizes);
+
+// The fixed-size matrices, the operand goes through DoNotOptimize so the constexpr functions are not folded.
+template <size_t N>
+static algebra::FixedMatrix<N, N> fixed_operand() {
+    return algebra::FixedMatrix<N, N>(invertible<DenseMatrix>(N));
+}
+
+template <size_t N>
+static void BM_FixedMultiply(benchmark::State& state) {
+    algebra::FixedMatrix<N, N> matrix = fixed_operand<N>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(matrix);
+        benchmark::DoNotOptimize(algebra::multiply(matrix, matrix));
+    }
+}
+BENCHMARK_TEMPLATE(BM_FixedMultiply, 2);
+BENCHMARK_TEMPLATE(BM_FixedMultiply, 4);
+BENCHMARK_TEMPLATE(BM_FixedMultiply, 8);
+
+template <size_t N>
+static void BM_FixedMultiplyScalar(benchmark::State& state) {
+    algebra::FixedMatrix<N, N> matrix = fixed_operand<N>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(matrix);
+        benchmark::DoNotOptimize(algebra::multiply(matrix, 1.5));
+    }
+}
+BENCHMARK_TEMPLATE(BM_FixedMultiplyScalar, 2);
+BENCHMARK_TEMPLATE(BM_FixedMultiplyScalar, 4);
+BENCHMARK_TEMPLATE(BM_FixedMultiplyScalar, 8);
+
+template <size_t N>
+static void BM_FixedSumScalar(benchmark::State& state) {
+    algebra::FixedMatrix<N, N> matrix = fixed_operand<N>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(matrix);
+        benchmark::DoNotOptimize(algebra::sum(matrix, 1.5));
+    }
+}
+BENCHMARK_TEMPLATE(BM_FixedSumScalar, 2);
+BENCHMARK_TEMPLATE(BM_FixedSumScalar, 4);
+BENCHMARK_TEMPLATE(BM_FixedSumScalar, 8);
+
+template <size_t N>
+static void BM_FixedSum(benchmark::State& state) {
+    algebra::FixedMatrix<N, N> matrix = fixed_operand<N>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(matrix);
+        benchmark::DoNotOptimize(algebra::sum(matrix, matrix));
+    }
+}
+BENCHMARK_TEMPLATE(BM_FixedSum, 2);
+BENCHMARK_TEMPLATE(BM_FixedSum, 4);
+BENCHMARK_TEMPLATE(BM_FixedSum, 8);
+
+template <size_t N>
+static void BM_FixedTranspose(benchmark::State& state) {
+    algebra::FixedMatrix<N, N> matrix = fixed_operand<N>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(matrix);
+        benchmark::DoNotOptimize(algebra::transpose(matrix));
+    }
+}
+BENCHMARK_TEMPLATE(BM_FixedTranspose, 2);
+BENCHMARK_TEMPLATE(BM_FixedTranspose, 4);
+BENCHMARK_TEMPLATE(BM_FixedTranspose, 8);
+
+template <size_t N>
+static void BM_FixedDeterminant(benchmark::State& state) {
+    algebra::FixedMatrix<N, N> matrix = fixed_operand<N>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(matrix);
+        benchmark::DoNotOptimize(algebra::determinant(matrix));
+    }
+}
+BENCHMARK_TEMPLATE(BM_FixedDeterminant, 2);
+BENCHMARK_TEMPLATE(BM_FixedDeterminant, 4);
+BENCHMARK_TEMPLATE(BM_FixedDeterminant, 8);
+
+template <size_t N>
+static void BM_FixedInverse(benchmark::State& state) {
+    algebra::FixedMatrix<N, N> matrix = fixed_operand<N>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(matrix);
+        benchmark::DoNotOptimize(algebra::inverse(matrix));
+    }
+}
+BENCHMARK_TEMPLATE(BM_FixedInverse, 2);
+BENCHMARK_TEMPLATE(BM_FixedInverse, 4);
+BENCHMARK_TEMPLATE(BM_FixedInverse, 8);
+
+static void BM_MultiplyBatch(benchmark::State& state) {
+    algebra::MatrixBatch batch = batch_operand(state.range(0));
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply_batch(batch, batch));
+    state.SetItemsProcessed(state.iterations() * batch.size());
+}
+BENCHMARK(BM_MultiplyBatch)->Apply(batch_sizes);
+
+static void BM_InverseBatch(benchmark::State& state) {
+    algebra::MatrixBatch batch = batch_operand(state.range(0));
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::inverse_batch(batch));
+    state.SetItemsProcessed(state.iterations() * batch.size());
+}
+BENCHMARK(BM_InverseBatch)->Apply(batch_sizes);
+
+static void BM_DeterminantBatch(benchmark::State& state) {
+    algebra::MatrixBatch batch = batch_operand(state.range(0));
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::determinant_batch(batch));
+    state.SetItemsProcessed(state.iterations() * batch.size());
+}
+BENCHMARK(BM_DeterminantBatch)->Apply(batch_sizes);
+
+static void BM_SparseFromDense(benchmark::State& state) {
+    size_t n = state.range(0);
+    DenseMatrix matrix = sparse_operand(n).to_dense();
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::SparseMatrix(matrix));
+}
+BENCHMARK(BM_SparseFromDense)->Apply(sizes);
+
+static void BM_MultiplySparseVector(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::SparseMatrix matrix = sparse_operand(n);
+    std::vector<double> x(n, 1.0);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply(matrix, x));
+}
+BENCHMARK(BM_MultiplySparseVector)->Apply(sizes);
+
+static void BM_MultiplySparseDense(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::SparseMatrix matrix1 = sparse_operand(n);
+    DenseMatrix matrix2 = operand<DenseMatrix>(n, n);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply(matrix1, matrix2));
+}
+BENCHMARK(BM_MultiplySparseDense)->Apply(sizes);
+
+static void BM_MultiplyDenseSparse(benchmark::State& state) {
+    size_t n = state.range(0);
+    DenseMatrix matrix1 = operand<DenseMatrix>(n, n);
+    algebra::SparseMatrix matrix2 = sparse_operand(n);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply(matrix1, matrix2));
+}
+BENCHMARK(BM_MultiplyDenseSparse)->Apply(sizes);
+
+static void BM_MultiplySparseSparse(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::SparseMatrix matrix1 = sparse_operand(n), matrix2 = sparse_operand(n);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::multiply(matrix1, matrix2));
+}
+BENCHMARK(BM_MultiplySparseSparse)->Apply(sizes);
+
+static void BM_SumSparseDense(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::SparseMatrix matrix1 = sparse_operand(n);
+    DenseMatrix matrix2 = operand<DenseMatrix>(n, n);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::sum(matrix1, matrix2));
+}
+BENCHMARK(BM_SumSparseDense)->Apply(sizes);
+
+static void BM_SumDenseSparse(benchmark::State& state) {
+    size_t n = state.range(0);
+    DenseMatrix matrix1 = operand<DenseMatrix>(n, n);
+    algebra::SparseMatrix matrix2 = sparse_operand(n);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::sum(matrix1, matrix2));
+}
+BENCHMARK(BM_SumDenseSparse)->Apply(sizes);
+
+static void BM_TransposeSparse(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::SparseMatrix matrix = sparse_operand(n);
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::transpose(matrix));
+}
+BENCHMARK(BM_TransposeSparse)->Apply(sizes);
+
+// The files are written to the working directory and removed at the end.
+static void BM_Save(benchmark::State& state) {
+    size_t n = state.range(0);
+    DenseMatrix matrix = operand<DenseMatrix>(n, n);
+    std::string path = "bench_suite_matrix.bin";
+    for (auto _ : state) algebra::save(path, matrix);
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_Save)->Apply(file_sizes);
+
+static void BM_Load(benchmark::State& state) {
+    size_t n = state.range(0);
+    std::string path = "bench_suite_matrix.bin";
+    algebra::save(path, operand<DenseMatrix>(n, n));
+    for (auto _ : state) benchmark::DoNotOptimize(algebra::load(path));
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_Load)->Apply(file_sizes);
+
+// The budget is half an operand, so the larger products go through several tiles.
+static void BM_MultiplyOutOfCore(benchmark::State& state) {
+    size_t n = state.range(0);
+    algebra::save("bench_suite_a.bin", operand<DenseMatrix>(n, n));
+    algebra::save("bench_suite_b.bin", operand<DenseMatrix>(n, n));
+    size_t budget = std::max<size_t>(n * n * sizeof(double) / 2, 1 << 20);
+    for (auto _ : state)
+        algebra::multiply_out_of_core("bench_suite_a.bin", "bench_suite_b.bin", "bench_suite_c.bin", budget);
+    std::remove("bench_suite_a.bin");
+    std::remove("bench_suite_b.bin");
+    std::remove("bench_suite_c.bin");
+}
+BENCHMARK(BM_MultiplyOutOfCore)->Apply(file_sizes);
+
+// BENCHMARK_MAIN, with the kernel variant of dispatch.h in the context of the run.
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    benchmark::AddCustomContext("algebra_isa", algebra::isa_name(algebra::get_isa()));
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
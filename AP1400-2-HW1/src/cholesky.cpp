@@ -0,0 +1,143 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include "cholesky.h"
+#include "gemm.h"
+#include "substitution.h"
+#include "thread_pool.h"
+#include "transpose.h"
+#include "workspace.h"
+
+using std::logic_error;
+using std::min;
+
+namespace algebra {
+    // The number of columns factorized before the trailing rows are updated.
+    static constexpr size_t cholesky_block = 128;
+
+    // The number of rows handled by one task when a panel is solved.
+    static constexpr size_t cholesky_chunk = 64;
+
+    Cholesky::Cholesky(const DenseMatrix& matrix) : _lower(matrix) {
+        // Check if the matrix is square
+        if (matrix.rows() != matrix.cols()) throw logic_error("The matrix should be square.");
+        size_t n = matrix.rows();
+        // Check if the matrix is symmetric, up to the rounding of the product which built it.
+        double largest = 0;
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = 0; j < n; j++) largest = std::max(largest, std::abs(matrix(i, j)));
+        double tolerance = largest * n * std::numeric_limits<double>::epsilon();
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = 0; j < i; j++)
+                if (std::abs(matrix(i, j) - matrix(j, i)) > tolerance)
+                    throw logic_error("The matrix should be symmetric.");
+        double *a = _lower.data();
+        size_t lda = _lower.stride();
+        // Right-looking by panels, only the lower triangle is read.
+        for (size_t k0 = 0; k0 < n; k0 += cholesky_block) {
+            size_t k1 = min(n, k0 + cholesky_block), width = k1 - k0, rest = n - k1;
+            // The triangle on the diagonal, row by row so the sums run along two rows of L.
+            for (size_t i = k0; i < k1; i++) {
+                double *row_i = a + i * lda;
+                for (size_t j = k0; j <= i; j++) {
+                    const double *row_j = a + j * lda;
+                    double value = row_i[j];
+                    for (size_t k = k0; k < j; k++) value -= row_i[k] * row_j[k];
+                    if (j < i) {
+                        row_i[j] = value / row_j[j];
+                    } else {
+                        // A non-positive pivot, or a NaN, means the matrix is not positive definite.
+                        if (!(value > 0)) throw logic_error("The matrix should be positive definite.");
+                        row_i[i] = std::sqrt(value);
+                    }
+                }
+            }
+            if (!rest) break;
+            // The rows of L below the panel are independent of each other. Each one is solved against L11^T,
+            // so the updates run along contiguous rows.
+            Scratch<double> panel(width * width);
+            for (size_t k = 0; k < width; k++)
+                for (size_t j = k; j < width; j++) panel[k * width + j] = a[(k0 + j) * lda + k0 + k];
+            thread_pool().parallel_for((rest + cholesky_chunk - 1) / cholesky_chunk, [&](size_t chunk) {
+                size_t first = k1 + chunk * cholesky_chunk, last = min(n, first + cholesky_chunk);
+                for (size_t i = first; i < last; i++) {
+                    double *row_i = a + i * lda + k0;
+                    for (size_t k = 0; k < width; k++) {
+                        const double *column_k = panel.data() + k * width;
+                        double l = row_i[k] /= column_k[k];
+                        for (size_t j = k + 1; j < width; j++) row_i[j] -= l * column_k[j];
+                    }
+                }
+            });
+            // A22 -= L21 * L21^T, the kernel only adds so the negated transpose is copied out.
+            // Only the blocks of columns on and below the diagonal are updated.
+            Scratch<double> upper(width * rest);
+            for (size_t i = 0; i < rest; i++)
+                for (size_t k = 0; k < width; k++) upper[k * rest + i] = -a[(k1 + i) * lda + k0 + k];
+            for (size_t j0 = k1; j0 < n; j0 += cholesky_block)
+                kernel::gemm_parallel(n - j0, min(n - j0, cholesky_block), width, a + j0 * lda + k0, lda,
+                                      upper.data() + j0 - k1, rest, a + j0 * lda + j0, lda);
+        }
+        // Clear what is left of A above the diagonal.
+        for (size_t i = 0; i < n; i++)
+            std::fill(_lower.row(i) + i + 1, _lower.row(i) + n, 0.0);
+        _upper = DenseMatrix(n, n);
+        kernel::transpose(n, n, _lower.data(), _lower.stride(), _upper.data(), _upper.stride());
+    }
+
+    size_t Cholesky::size() const {
+        return _lower.rows();
+    }
+
+    const DenseMatrix& Cholesky::lower() const {
+        return _lower;
+    }
+
+    double Cholesky::determinant() const {
+        // The determinant of L squared.
+        double res = 1;
+        for (size_t i = 0; i < size(); i++) res *= _lower(i, i) * _lower(i, i);
+        return res;
+    }
+
+    DenseMatrix Cholesky::inverse() const {
+        // Solve A * X = I.
+        size_t n = size();
+        DenseMatrix identity(n, n);
+        for (size_t i = 0; i < n; i++) identity(i, i) = 1;
+        return solve(identity);
+    }
+
+    DenseMatrix Cholesky::solve(const DenseMatrix& b) const {
+        // Check if the right-hand sides fit the matrix
+        if (b.rows() != size()) throw logic_error("The right-hand side should have as many rows as the matrix.");
+        DenseMatrix res(b);
+        // L * Y = B, then L^T * X = Y.
+        kernel::solve_lower(size(), res.cols(), _lower.data(), _lower.stride(), false, res.data(), res.stride());
+        kernel::solve_upper(size(), res.cols(), _upper.data(), _upper.stride(), res.data(), res.stride());
+        return res;
+    }
+
+    std::vector<double> Cholesky::solve(const std::vector<double>& b) const {
+        DenseMatrix column(b.size(), 1);
+        for (size_t i = 0; i < b.size(); i++) column(i, 0) = b[i];
+        column = solve(column);
+        std::vector<double> res(b.size());
+        for (size_t i = 0; i < b.size(); i++) res[i] = column(i, 0);
+        return res;
+    }
+
+    Cholesky cholesky(const DenseMatrix& matrix) {
+        return Cholesky(matrix);
+    }
+
+    Cholesky cholesky(const Matrix& matrix) {
+        return Cholesky(DenseMatrix(matrix));
+    }
+}
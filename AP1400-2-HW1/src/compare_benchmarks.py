@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+#
+# Created by Daniel X Feng
+# Created Date: 17 Oct 2026.
+#
+
+"""Compare two JSON outputs of the benchmark suite and flag the regressions.
+
+Produce the runs with the benchmark_json target, or with
+    bench_suite --benchmark_out=run.json --benchmark_out_format=json
+then compare them with
+    compare_benchmarks.py baseline.json contender.json --threshold 0.1
+
+Every benchmark present in both runs is listed with its time ratio, contender / baseline.
+A ratio above 1 + threshold is a regression, below 1 - threshold an improvement.
+When the runs were made with --benchmark_repetitions, the medians are compared.
+The kernel variants are compared by pinning one per run, e.g. ALGEBRA_ISA=avx2 bench_suite ...,
+the variant of each run is printed from its context.
+The exit status is 1 if there is a regression, so the script can gate a CI job.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path, metric):
+    """Return {benchmark name: time in nanoseconds} of one run."""
+    with open(path) as f:
+        run = json.load(f)
+    scale = {'ns': 1, 'us': 1e3, 'ms': 1e6, 's': 1e9}
+    times, medians = {}, {}
+    for benchmark in run['benchmarks']:
+        if benchmark.get('error_occurred'):
+            continue
+        value = benchmark[metric] * scale[benchmark.get('time_unit', 'ns')]
+        if benchmark.get('run_type') == 'aggregate':
+            if benchmark.get('aggregate_name') == 'median':
+                medians[benchmark['run_name']] = value
+        else:
+            # The repetitions of one benchmark share its name, keep the fastest until a median shows up.
+            name = benchmark.get('run_name', benchmark['name'])
+            times[name] = min(value, times.get(name, value))
+    times.update(medians)
+    return times
+
+
+def isa(path):
+    """Return the kernel variant the run was made with, or '?' for runs without it."""
+    with open(path) as f:
+        return json.load(f)['context'].get('algebra_isa', '?')
+
+
+def format_time(ns):
+    for unit, scale in (('s', 1e9), ('ms', 1e6), ('us', 1e3)):
+        if ns >= scale:
+            return '%.3g %s' % (ns / scale, unit)
+    return '%.3g ns' % ns
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare two runs of the benchmark suite.')
+    parser.add_argument('baseline', help='the JSON output of the reference run')
+    parser.add_argument('contender', help='the JSON output of the run to check')
+    parser.add_argument('--threshold', type=float, default=0.1,
+                        help='the relative slow down reported as a regression (default 0.1)')
+    parser.add_argument('--metric', choices=('real_time', 'cpu_time'), default='real_time',
+                        help='the time compared, real_time counts the worker threads (default real_time)')
+    parser.add_argument('--all', action='store_true', help='list the unchanged benchmarks too')
+    args = parser.parse_args()
+
+    baseline = load(args.baseline, args.metric)
+    contender = load(args.contender, args.metric)
+    common = [name for name in baseline if name in contender]
+    regressions = improvements = 0
+    width = max([len(name) for name in common] + [9])
+    print('kernels: %s in the baseline, %s in the contender' % (isa(args.baseline), isa(args.contender)))
+    print('%-*s %12s %12s %8s' % (width, 'benchmark', 'baseline', 'contender', 'ratio'))
+    for name in common:
+        ratio = contender[name] / baseline[name] if baseline[name] else float('inf')
+        if ratio > 1 + args.threshold:
+            status = 'REGRESSION'
+            regressions += 1
+        elif ratio < 1 - args.threshold:
+            status = 'improved'
+            improvements += 1
+        else:
+            status = ''
+        if status or args.all:
+            print('%-*s %12s %12s %8.3f %s' % (width, name, format_time(baseline[name]),
+                                               format_time(contender[name]), ratio, status))
+    for name in baseline:
+        if name not in contender:
+            print('%-*s missing from the contender' % (width, name))
+    print('%d benchmarks compared, %d regressions and %d improvements above %.0f%%'
+          % (len(common), regressions, improvements, args.threshold * 100))
+    return 1 if regressions else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
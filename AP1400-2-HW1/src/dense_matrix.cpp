@@ -0,0 +1,131 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include "dense_matrix.h"
+#include "workspace.h"
+
+using std::logic_error;
+
+namespace algebra {
+    template <typename T>
+    BasicDenseMatrix<T>::BasicDenseMatrix() : _rows(0), _cols(0), _stride(0) {}
+
+    template <typename T>
+    BasicDenseMatrix<T>::BasicDenseMatrix(size_t rows, size_t cols)
+            : _rows(rows), _cols(cols), _stride(padded_stride(cols)) {
+        allocate();
+    }
+
+    template <typename T>
+    BasicDenseMatrix<T>::BasicDenseMatrix(size_t rows, size_t cols, T value) : BasicDenseMatrix(rows, cols) {
+        for (size_t i = 0; i < _rows; i++)
+            std::fill(row(i), row(i) + _cols, value);
+    }
+
+    template <typename T>
+    BasicDenseMatrix<T>::BasicDenseMatrix(std::initializer_list<std::initializer_list<T>> list)
+            : BasicDenseMatrix(list.size(), list.size() ? list.begin()->size() : 0) {
+        size_t i = 0;
+        for (const auto &r : list) {
+            // Check if all rows have the same length.
+            if (r.size() != _cols) throw logic_error("All rows should have the same length.");
+            std::copy(r.begin(), r.end(), row(i++));
+        }
+    }
+
+    template <typename T>
+    BasicDenseMatrix<T>::BasicDenseMatrix(const Matrix &matrix)
+            : BasicDenseMatrix(matrix.size(), matrix.empty() ? 0 : matrix[0].size()) {
+        for (size_t i = 0; i < _rows; i++) {
+            // Check if all rows have the same length.
+            if (matrix[i].size() != _cols) throw logic_error("All rows should have the same length.");
+            std::copy(matrix[i].begin(), matrix[i].end(), row(i));
+        }
+    }
+
+    template <typename T>
+    BasicDenseMatrix<T>::BasicDenseMatrix(size_t rows, size_t cols, std::shared_ptr<T> data)
+            : _rows(rows), _cols(cols), _stride(padded_stride(cols)), _data(std::move(data)) {}
+
+    template <typename T>
+    BasicDenseMatrix<T>::BasicDenseMatrix(const BasicDenseMatrix &other)
+            : _rows(other._rows), _cols(other._cols), _stride(other._stride) {
+        allocate();
+        // The padding is zero in both buffers, so copy them as a whole.
+        if (_data) std::memcpy(_data.get(), other._data.get(), _rows * _stride * sizeof(T));
+    }
+
+    template <typename T>
+    BasicDenseMatrix<T>::BasicDenseMatrix(BasicDenseMatrix &&other) noexcept
+            : _rows(other._rows), _cols(other._cols), _stride(other._stride), _data(std::move(other._data)) {
+        other._rows = other._cols = other._stride = 0;
+    }
+
+    template <typename T>
+    BasicDenseMatrix<T> &BasicDenseMatrix<T>::operator=(const BasicDenseMatrix &other) {
+        if (this == &other) return *this;
+        BasicDenseMatrix copy(other);
+        return *this = std::move(copy);
+    }
+
+    template <typename T>
+    BasicDenseMatrix<T> &BasicDenseMatrix<T>::operator=(BasicDenseMatrix &&other) noexcept {
+        if (this == &other) return *this;
+        _rows = other._rows;
+        _cols = other._cols;
+        _stride = other._stride;
+        _data = std::move(other._data);
+        other._rows = other._cols = other._stride = 0;
+        return *this;
+    }
+
+    template <typename T>
+    Matrix BasicDenseMatrix<T>::to_matrix() const {
+        Matrix res(_rows);
+        for (size_t i = 0; i < _rows; i++)
+            res[i].assign(row(i), row(i) + _cols);
+        return res;
+    }
+
+    template <typename T>
+    bool BasicDenseMatrix<T>::operator==(const BasicDenseMatrix &other) const {
+        if (_rows != other._rows || _cols != other._cols) return false;
+        for (size_t i = 0; i < _rows; i++)
+            if (!std::equal(row(i), row(i) + _cols, other.row(i))) return false;
+        return true;
+    }
+
+    template <typename T>
+    bool BasicDenseMatrix<T>::operator!=(const BasicDenseMatrix &other) const {
+        return !(*this == other);
+    }
+
+    template <typename T>
+    size_t BasicDenseMatrix<T>::padded_stride(size_t cols) {
+        // The number of elements in one cache line.
+        constexpr size_t line_elements = alignment / sizeof(T);
+        return (cols + line_elements - 1) / line_elements * line_elements;
+    }
+
+    template <typename T>
+    void BasicDenseMatrix<T>::allocate() {
+        size_t bytes = _rows * _stride * sizeof(T);
+        // Nothing to allocate for an empty matrix.
+        if (!bytes) {
+            _data.reset();
+            return;
+        }
+        // The buffer and the control block of the shared pointer both come from the buffer cache.
+        void *p = allocate_buffer(bytes);
+        std::memset(p, 0, bytes);
+        _data.reset(static_cast<T *>(p), [bytes](T *ptr) { release_buffer(ptr, bytes); }, BufferAllocator<T>());
+    }
+
+    template class BasicDenseMatrix<float>;
+    template class BasicDenseMatrix<double>;
+}
@@ -0,0 +1,138 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_DENSE_MATRIX_H
+#define SRC_DENSE_MATRIX_H
+
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+using Matrix = std::vector<std::vector<double>>;
+
+namespace algebra {
+    // A dense row-major matrix of T, float or double, which keeps all the elements in one aligned buffer.
+    // Every row starts on a cache line, the gap between two rows is given by stride().
+    // The padding elements at the end of each row are always zero.
+    template <typename T>
+    class BasicDenseMatrix {
+    public:
+        // The type of the elements.
+        using value_type = T;
+
+        // The alignment of the buffer and of every row, in bytes.
+        static constexpr size_t alignment = 64;
+
+        // Default constructor that will create an empty 0*0 matrix.
+        BasicDenseMatrix();
+
+        // Constructor that creates a rows*cols matrix with all elements equal to zero.
+        BasicDenseMatrix(size_t rows, size_t cols);
+
+        // Constructor that creates a rows*cols matrix with all elements equal to value.
+        BasicDenseMatrix(size_t rows, size_t cols, T value);
+
+        // Constructor that takes the rows as nested lists, all rows must have the same length.
+        BasicDenseMatrix(std::initializer_list<std::initializer_list<T>> list);
+
+        // Convert from the vector-of-vectors Matrix, costs a single copy.
+        // Throw logic_error if the rows have different length.
+        explicit BasicDenseMatrix(const Matrix &matrix);
+
+        // Convert from a matrix of another scalar type, rounding every element to T.
+        template <typename U>
+        explicit BasicDenseMatrix(const BasicDenseMatrix<U> &other);
+
+        // Constructor that adopts an external buffer of rows*padded_stride(cols) elements, e.g. a memory mapped file.
+        // The buffer must be aligned and the padding must be zero.
+        // The deleter of data releases the buffer when the last matrix using it goes away.
+        BasicDenseMatrix(size_t rows, size_t cols, std::shared_ptr<T> data);
+
+        // Return the stride of a matrix with the given number of columns, cols rounded up to a full cache line.
+        // Matrices of the same shape always have the same layout.
+        static size_t padded_stride(size_t cols);
+
+        // Copy constructor, copies the elements into a new buffer.
+        BasicDenseMatrix(const BasicDenseMatrix &other);
+
+        // Move constructor, steals the buffer.
+        BasicDenseMatrix(BasicDenseMatrix &&other) noexcept;
+
+        // Copy assignment.
+        BasicDenseMatrix &operator=(const BasicDenseMatrix &other);
+
+        // Move assignment.
+        BasicDenseMatrix &operator=(BasicDenseMatrix &&other) noexcept;
+
+        // Destructor.
+        ~BasicDenseMatrix() = default;
+
+        // Return the number of rows.
+        size_t rows() const { return _rows; }
+
+        // Return the number of columns.
+        size_t cols() const { return _cols; }
+
+        // Return the distance in elements between the beginning of two neighbour rows.
+        size_t stride() const { return _stride; }
+
+        // Return true if the matrix has no element.
+        bool empty() const { return _rows == 0 || _cols == 0; }
+
+        // Return the pointer to the first element.
+        T *data() { return _data.get(); }
+        const T *data() const { return _data.get(); }
+
+        // Return the pointer to the first element of rth row.
+        T *row(size_t r) { return _data.get() + r * _stride; }
+        const T *row(size_t r) const { return _data.get() + r * _stride; }
+
+        // Return the element at rth row and cth column, no bound check.
+        T &operator()(size_t r, size_t c) { return _data.get()[r * _stride + c]; }
+        T operator()(size_t r, size_t c) const { return _data.get()[r * _stride + c]; }
+
+        // Convert to the vector-of-vectors Matrix of doubles, costs a single copy.
+        Matrix to_matrix() const;
+
+        // Return true if both matrices have the same shape and the same elements.
+        bool operator==(const BasicDenseMatrix &other) const;
+
+        bool operator!=(const BasicDenseMatrix &other) const;
+
+    private:
+        // The number of rows.
+        size_t _rows;
+        // The number of columns.
+        size_t _cols;
+        // The number of elements between two rows, cols rounded up to a full cache line.
+        size_t _stride;
+        // The aligned buffer of rows*stride elements.
+        std::shared_ptr<T> _data;
+
+        // A helper method to allocate a zeroed buffer for the current shape.
+        void allocate();
+    };
+
+    template <typename T>
+    constexpr size_t BasicDenseMatrix<T>::alignment;
+
+    template <typename T>
+    template <typename U>
+    BasicDenseMatrix<T>::BasicDenseMatrix(const BasicDenseMatrix<U> &other)
+            : BasicDenseMatrix(other.rows(), other.cols()) {
+        for (size_t i = 0; i < _rows; i++)
+            for (size_t j = 0; j < _cols; j++) (*this)(i, j) = static_cast<T>(other(i, j));
+    }
+
+    // The double matrix used by most of the algebra functions, and its single precision twin.
+    using DenseMatrix = BasicDenseMatrix<double>;
+    using DenseMatrixF = BasicDenseMatrix<float>;
+
+    // The members are compiled once in dense_matrix.cpp for both types.
+    extern template class BasicDenseMatrix<float>;
+    extern template class BasicDenseMatrix<double>;
+}
+
+#endif //SRC_DENSE_MATRIX_H
@@ -0,0 +1,207 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include "dispatch.h"
+#include "elementwise.h"
+#include "elimination.h"
+#include "gemm.h"
+#include "isa.h"
+#include "transpose.h"
+
+using std::logic_error;
+
+namespace algebra {
+    // The selected variant, -1 until the first kernel runs.
+    static std::atomic<int> selected(-1);
+
+    // The variants in the order they are preferred.
+    static const Isa variants[] = {Isa::avx512, Isa::avx2, Isa::generic};
+
+    const char *isa_name(Isa isa) {
+        switch (isa) {
+            case Isa::avx512:
+                return "avx512";
+            case Isa::avx2:
+                return "avx2";
+            default:
+                return "generic";
+        }
+    }
+
+    bool isa_supported(Isa isa) {
+#if defined(ALGEBRA_DISPATCH)
+        // The checks of the compiler runtime also ask the OS whether it saves the wide registers.
+        __builtin_cpu_init();
+        switch (isa) {
+            case Isa::avx512:
+                return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl")
+                       && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512dq")
+                       && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+            case Isa::avx2:
+                return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+            default:
+                return true;
+        }
+#else
+        return isa == Isa::generic;
+#endif
+    }
+
+    Isa best_isa() {
+        for (Isa isa : variants)
+            if (isa_supported(isa)) return isa;
+        return Isa::generic;
+    }
+
+    // Return the variant named by ALGEBRA_ISA, or the best one if it is unset, unknown or not supported.
+    static Isa initial_isa() {
+        const char *name = std::getenv("ALGEBRA_ISA");
+        if (!name || !*name) return best_isa();
+        for (Isa isa : variants) {
+            if (std::strcmp(name, isa_name(isa)) != 0) continue;
+            if (isa_supported(isa)) return isa;
+            std::cerr << "ALGEBRA_ISA=" << name << " is not supported on this CPU, using "
+                      << isa_name(best_isa()) << ".\n";
+            return best_isa();
+        }
+        std::cerr << "ALGEBRA_ISA=" << name << " is unknown, using " << isa_name(best_isa()) << ".\n";
+        return best_isa();
+    }
+
+    void set_isa(Isa isa) {
+        if (!isa_supported(isa)) throw logic_error("The instruction set is not supported.");
+        selected = static_cast<int>(isa);
+    }
+
+    Isa get_isa() {
+        int isa = selected.load(std::memory_order_relaxed);
+        if (isa < 0) {
+            // Two threads may both get here, they resolve the same variant.
+            int initial = static_cast<int>(initial_isa());
+            selected.compare_exchange_strong(isa, initial);
+            isa = selected.load(std::memory_order_relaxed);
+        }
+        return static_cast<Isa>(isa);
+    }
+
+    namespace kernel {
+        // Call the function of the selected variant.
+#if defined(ALGEBRA_DISPATCH)
+#define ALGEBRA_DISPATCH_CALL(function, ...)                \
+        switch (get_isa()) {                                \
+            case Isa::avx512:                               \
+                return avx512::function(__VA_ARGS__);       \
+            case Isa::avx2:                                 \
+                return avx2::function(__VA_ARGS__);         \
+            default:                                        \
+                return generic::function(__VA_ARGS__);      \
+        }
+#else
+#define ALGEBRA_DISPATCH_CALL(function, ...) return generic::function(__VA_ARGS__);
+#endif
+
+        const char *elementwise_isa() {
+            ALGEBRA_DISPATCH_CALL(elementwise_isa)
+        }
+
+        void scale(const double *src, double c, double *dst, size_t n) {
+            ALGEBRA_DISPATCH_CALL(scale, src, c, dst, n)
+        }
+
+        void scale(const float *src, float c, float *dst, size_t n) {
+            ALGEBRA_DISPATCH_CALL(scale, src, c, dst, n)
+        }
+
+        void shift(const double *src, double c, double *dst, size_t n) {
+            ALGEBRA_DISPATCH_CALL(shift, src, c, dst, n)
+        }
+
+        void shift(const float *src, float c, float *dst, size_t n) {
+            ALGEBRA_DISPATCH_CALL(shift, src, c, dst, n)
+        }
+
+        void add(const double *a, const double *b, double *dst, size_t n) {
+            ALGEBRA_DISPATCH_CALL(add, a, b, dst, n)
+        }
+
+        void add(const float *a, const float *b, float *dst, size_t n) {
+            ALGEBRA_DISPATCH_CALL(add, a, b, dst, n)
+        }
+
+        void subtract(const double *a, const double *b, double *dst, size_t n) {
+            ALGEBRA_DISPATCH_CALL(subtract, a, b, dst, n)
+        }
+
+        void subtract(const float *a, const float *b, float *dst, size_t n) {
+            ALGEBRA_DISPATCH_CALL(subtract, a, b, dst, n)
+        }
+
+        void gemm(size_t m, size_t n, size_t k,
+                  const double *a, size_t lda,
+                  const double *b, size_t ldb,
+                  double *c, size_t ldc) {
+            ALGEBRA_DISPATCH_CALL(gemm, m, n, k, a, lda, b, ldb, c, ldc)
+        }
+
+        void gemm(size_t m, size_t n, size_t k,
+                  const float *a, size_t lda,
+                  const float *b, size_t ldb,
+                  float *c, size_t ldc) {
+            ALGEBRA_DISPATCH_CALL(gemm, m, n, k, a, lda, b, ldb, c, ldc)
+        }
+
+        void gemm_parallel(size_t m, size_t n, size_t k,
+                           const double *a, size_t lda,
+                           const double *b, size_t ldb,
+                           double *c, size_t ldc) {
+            ALGEBRA_DISPATCH_CALL(gemm_parallel, m, n, k, a, lda, b, ldb, c, ldc)
+        }
+
+        void gemm_parallel(size_t m, size_t n, size_t k,
+                           const float *a, size_t lda,
+                           const float *b, size_t ldb,
+                           float *c, size_t ldc) {
+            ALGEBRA_DISPATCH_CALL(gemm_parallel, m, n, k, a, lda, b, ldb, c, ldc)
+        }
+
+        void gemm_mixed(size_t m, size_t n, size_t k,
+                        const float *a, size_t lda,
+                        const float *b, size_t ldb,
+                        float *c, size_t ldc) {
+            ALGEBRA_DISPATCH_CALL(gemm_mixed, m, n, k, a, lda, b, ldb, c, ldc)
+        }
+
+        void transpose(size_t rows, size_t cols, const double *src, size_t lds, double *dst, size_t ldd) {
+            ALGEBRA_DISPATCH_CALL(transpose, rows, cols, src, lds, dst, ldd)
+        }
+
+        void transpose(size_t rows, size_t cols, const float *src, size_t lds, float *dst, size_t ldd) {
+            ALGEBRA_DISPATCH_CALL(transpose, rows, cols, src, lds, dst, ldd)
+        }
+
+        void transpose_in_place(size_t n, double *a, size_t lda) {
+            ALGEBRA_DISPATCH_CALL(transpose_in_place, n, a, lda)
+        }
+
+        void transpose_in_place(size_t n, float *a, size_t lda) {
+            ALGEBRA_DISPATCH_CALL(transpose_in_place, n, a, lda)
+        }
+
+        int eliminate(size_t n, double *a, size_t lda, size_t *pivot) {
+            ALGEBRA_DISPATCH_CALL(eliminate, n, a, lda, pivot)
+        }
+
+        int eliminate(size_t n, float *a, size_t lda, size_t *pivot) {
+            ALGEBRA_DISPATCH_CALL(eliminate, n, a, lda, pivot)
+        }
+
+#undef ALGEBRA_DISPATCH_CALL
+    }
+}
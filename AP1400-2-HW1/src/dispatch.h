@@ -0,0 +1,37 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_DISPATCH_H
+#define SRC_DISPATCH_H
+
+// The choice of instruction set for the hot kernels: the products, the element-wise kernels,
+// the transposes and the elimination. On x86-64 with GCC they are built in a generic variant (SSE2),
+// an AVX2 + FMA variant and an AVX-512 variant, and the widest one the CPU and the OS support is picked
+// on first use. The environment variable ALGEBRA_ISA=generic|avx2|avx512 pins a variant instead, e.g. for
+// A/B runs of the benchmarks. Elsewhere, or with ALGEBRA_NATIVE, only the generic variant is built.
+namespace algebra {
+    // The variants of the kernels, from the narrowest.
+    enum class Isa {
+        generic,
+        avx2,
+        avx512
+    };
+
+    // Return the name of the variant, as ALGEBRA_ISA spells it.
+    const char *isa_name(Isa isa);
+
+    // Return true if the variant is built and this CPU can run it.
+    bool isa_supported(Isa isa);
+
+    // Return the widest supported variant.
+    Isa best_isa();
+
+    // The variant the kernels run. The default is best_isa(), or the one named by ALGEBRA_ISA if it is supported.
+    // Throw logic_error if the variant is not supported.
+    void set_isa(Isa isa);
+    Isa get_isa();
+}
+
+#endif //SRC_DISPATCH_H
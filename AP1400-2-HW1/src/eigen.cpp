@@ -0,0 +1,221 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include "eigen.h"
+#include "thread_pool.h"
+#include "transpose.h"
+#include "workspace.h"
+
+using std::logic_error;
+using std::min;
+
+namespace algebra {
+    // The number of rows handled by one task of the reduction.
+    static constexpr size_t eigen_chunk = 64;
+
+    // The number of columns handled by one task when the reflections and the rotations are applied.
+    static constexpr size_t eigen_nc = 256;
+
+    // The QR iteration gives up after this number of steps per eigenvalue.
+    static constexpr size_t eigen_iterations = 30;
+
+    // Reduce the symmetric n*n matrix A to the tridiagonal T = Q^T * A * Q, with d its diagonal and e the one above.
+    // Row k of A keeps the Householder vector of step k in its columns [k+1, n), and beta[k] its scale.
+    static void tridiagonalize(size_t n, double *a, size_t lda, double *d, double *e, double *beta) {
+        for (size_t k = 0; k + 2 < n; k++) {
+            size_t m = n - k - 1;
+            // The column below the diagonal is the row right of it, the vector overwrites it.
+            double *v = a + k * lda + k + 1, *b = a + (k + 1) * lda + k + 1;
+            double sigma = 0;
+            for (size_t i = 1; i < m; i++) sigma += v[i] * v[i];
+            d[k] = a[k * lda + k];
+            if (sigma == 0) {
+                // Nothing to eliminate, H is the identity.
+                e[k] = v[0];
+                beta[k] = 0;
+                continue;
+            }
+            // H * x = alpha * e1 with H = I - beta * v * v^T, alpha has the sign which avoids cancellation.
+            double norm = std::sqrt(v[0] * v[0] + sigma), alpha = v[0] <= 0 ? norm : -norm;
+            v[0] -= alpha;
+            beta[k] = 2 / (v[0] * v[0] + sigma);
+            e[k] = alpha;
+            // B = H * B * H = B - v * w^T - w * v^T, where p = beta * B * v and w = p - (beta / 2) * (p^T * v) * v.
+            Scratch<double> w(m);
+            size_t chunks = (m + eigen_chunk - 1) / eigen_chunk;
+            thread_pool().parallel_for(chunks, [&](size_t chunk) {
+                for (size_t i = chunk * eigen_chunk; i < min(m, (chunk + 1) * eigen_chunk); i++) {
+                    const double *row = b + i * lda;
+                    double value = 0;
+                    for (size_t j = 0; j < m; j++) value += row[j] * v[j];
+                    w[i] = beta[k] * value;
+                }
+            });
+            double pv = 0;
+            for (size_t i = 0; i < m; i++) pv += w[i] * v[i];
+            for (size_t i = 0; i < m; i++) w[i] -= beta[k] / 2 * pv * v[i];
+            thread_pool().parallel_for(chunks, [&](size_t chunk) {
+                for (size_t i = chunk * eigen_chunk; i < min(m, (chunk + 1) * eigen_chunk); i++) {
+                    double *row = b + i * lda;
+                    double vi = v[i], wi = w[i];
+                    for (size_t j = 0; j < m; j++) row[j] -= vi * w[j] + wi * v[j];
+                }
+            });
+        }
+        if (n >= 2) {
+            d[n - 2] = a[(n - 2) * lda + n - 2];
+            e[n - 2] = a[(n - 2) * lda + n - 1];
+        }
+        if (n) d[n - 1] = a[(n - 1) * lda + n - 1];
+    }
+
+    // Return Q = H_0 * H_1 * ... * H_{n-3} from the vectors left by tridiagonalize.
+    // The reflections are applied from the last one, so each touches only the block it changes.
+    static DenseMatrix accumulate(size_t n, const double *a, size_t lda, const double *beta) {
+        DenseMatrix q(n, n);
+        for (size_t i = 0; i < n; i++) q(i, i) = 1;
+        for (size_t k = n > 2 ? n - 2 : 0; k-- > 0;) {
+            if (beta[k] == 0) continue;
+            size_t first = k + 1, m = n - first;
+            const double *v = a + k * lda + first;
+            // Q = Q - beta * v * (v^T * Q) on the rows and the columns [k+1, n), by chunks of columns.
+            thread_pool().parallel_for((m + eigen_nc - 1) / eigen_nc, [&](size_t chunk) {
+                size_t j0 = first + chunk * eigen_nc, j1 = min(n, j0 + eigen_nc);
+                double u[eigen_nc] = {};
+                for (size_t i = 0; i < m; i++) {
+                    const double *row = q.row(first + i);
+                    for (size_t j = j0; j < j1; j++) u[j - j0] += v[i] * row[j];
+                }
+                for (size_t i = 0; i < m; i++) {
+                    double *row = q.row(first + i);
+                    double scale = beta[k] * v[i];
+                    for (size_t j = j0; j < j1; j++) row[j] -= scale * u[j - j0];
+                }
+            });
+        }
+        return q;
+    }
+
+    // One implicit QR step with the Wilkinson shift on the unreduced block [lo, hi] of the tridiagonal matrix.
+    // The bulge is chased down by Givens rotations G_k on the rows and the columns k and k+1, T = G_k * T * G_k^T,
+    // their cosines and sines are stored in rotations.
+    static void qr_step(size_t lo, size_t hi, double *d, double *e, double *rotations) {
+        double delta = (d[hi - 1] - d[hi]) / 2;
+        double mu = d[hi] - e[hi - 1] * e[hi - 1] / (delta + std::copysign(std::hypot(delta, e[hi - 1]), delta));
+        double x = d[lo] - mu, z = e[lo];
+        for (size_t k = lo; k < hi; k++) {
+            double r = std::hypot(x, z), c = 1, s = 0;
+            if (r != 0) {
+                c = x / r;
+                s = z / r;
+            }
+            if (k > lo) e[k - 1] = r;
+            double a = d[k], b = e[k], f = d[k + 1];
+            d[k] = c * c * a + 2 * c * s * b + s * s * f;
+            d[k + 1] = s * s * a - 2 * c * s * b + c * c * f;
+            e[k] = c * s * (f - a) + (c * c - s * s) * b;
+            // The rotation leaves a bulge right of the next off-diagonal element.
+            if (k + 1 < hi) {
+                x = e[k];
+                z = s * e[k + 1];
+                e[k + 1] *= c;
+            }
+            rotations[2 * (k - lo)] = c;
+            rotations[2 * (k - lo) + 1] = s;
+        }
+    }
+
+    SymmetricEigen::SymmetricEigen(const DenseMatrix& matrix, bool vectors)
+            : _values(matrix.rows()), _has_vectors(vectors) {
+        // Check if the matrix is square
+        if (matrix.rows() != matrix.cols()) throw logic_error("The matrix should be square.");
+        size_t n = matrix.rows();
+        // Check if the matrix is symmetric, up to the rounding of the product which built it.
+        double largest = 0;
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = 0; j < n; j++) largest = std::max(largest, std::abs(matrix(i, j)));
+        double tolerance = largest * n * std::numeric_limits<double>::epsilon();
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = 0; j < i; j++)
+                if (std::abs(matrix(i, j) - matrix(j, i)) > tolerance)
+                    throw logic_error("The matrix should be symmetric.");
+        if (!n) return;
+        DenseMatrix a(matrix);
+        Scratch<double> d(n), e(n), beta(n), rotations(2 * n);
+        tridiagonalize(n, a.data(), a.stride(), d.data(), e.data(), beta.data());
+        // W = Q^T, the rotations of the QR steps then combine pairs of contiguous rows.
+        DenseMatrix w;
+        if (vectors) {
+            DenseMatrix q = accumulate(n, a.data(), a.stride(), beta.data());
+            w = DenseMatrix(n, n);
+            kernel::transpose(n, n, q.data(), q.stride(), w.data(), w.stride());
+        }
+        size_t steps = 0;
+        for (size_t hi = n - 1; hi > 0;) {
+            // An off-diagonal element negligible against its neighbours on the diagonal splits the matrix.
+            for (size_t i = 0; i < hi; i++)
+                if (std::abs(e[i]) <= std::numeric_limits<double>::epsilon() * (std::abs(d[i]) + std::abs(d[i + 1]))
+                    || std::abs(e[i]) < std::numeric_limits<double>::min())
+                    e[i] = 0;
+            while (hi > 0 && e[hi - 1] == 0) hi--;
+            if (!hi) break;
+            size_t lo = hi - 1;
+            while (lo > 0 && e[lo - 1] != 0) lo--;
+            if (++steps > eigen_iterations * n) throw logic_error("The eigenvalues did not converge.");
+            qr_step(lo, hi, d.data(), e.data(), rotations.data());
+            if (!vectors) continue;
+            // Every chunk of columns goes through the rotations of the step in order.
+            thread_pool().parallel_for((n + eigen_nc - 1) / eigen_nc, [&](size_t chunk) {
+                size_t j0 = chunk * eigen_nc, j1 = min(n, j0 + eigen_nc);
+                for (size_t k = lo; k < hi; k++) {
+                    double c = rotations[2 * (k - lo)], s = rotations[2 * (k - lo) + 1];
+                    double *row_k = w.row(k), *row_next = w.row(k + 1);
+                    for (size_t j = j0; j < j1; j++) {
+                        double first = row_k[j], second = row_next[j];
+                        row_k[j] = c * first + s * second;
+                        row_next[j] = c * second - s * first;
+                    }
+                }
+            });
+        }
+        // Sort the eigenvalues, and move their vectors to the columns.
+        std::vector<size_t> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](size_t i, size_t j) { return d[i] < d[j]; });
+        for (size_t i = 0; i < n; i++) _values[i] = d[order[i]];
+        if (!vectors) return;
+        _vectors = DenseMatrix(n, n);
+        for (size_t i = 0; i < n; i++) {
+            const double *row = w.row(order[i]);
+            for (size_t r = 0; r < n; r++) _vectors(r, i) = row[r];
+        }
+    }
+
+    size_t SymmetricEigen::size() const {
+        return _values.size();
+    }
+
+    const std::vector<double>& SymmetricEigen::values() const {
+        return _values;
+    }
+
+    const DenseMatrix& SymmetricEigen::vectors() const {
+        if (!_has_vectors) throw logic_error("The eigenvectors were not computed.");
+        return _vectors;
+    }
+
+    SymmetricEigen eigen_symmetric(const DenseMatrix& matrix, bool vectors) {
+        return SymmetricEigen(matrix, vectors);
+    }
+
+    SymmetricEigen eigen_symmetric(const Matrix& matrix, bool vectors) {
+        return SymmetricEigen(DenseMatrix(matrix), vectors);
+    }
+}
@@ -0,0 +1,43 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_EIGEN_H
+#define SRC_EIGEN_H
+
+#include <vector>
+#include "dense_matrix.h"
+
+namespace algebra {
+    // The eigen-decomposition A = V * diag(values) * V^T of a symmetric matrix, in O(n^3).
+    // A is reduced to a tridiagonal matrix by Householder reflections, which is then diagonalized
+    // by the implicit QR iteration with Wilkinson shifts.
+    class SymmetricEigen {
+    public:
+        // Decompose the given matrix, the eigenvectors are skipped if vectors is false, which is about 3 times faster.
+        // Throw logic_error if the matrix is not square or not symmetric, or if the iteration does not converge.
+        explicit SymmetricEigen(const DenseMatrix& matrix, bool vectors = true);
+
+        // Return the number of rows of the decomposed matrix.
+        size_t size() const;
+
+        // Return the eigenvalues in ascending order.
+        const std::vector<double>& values() const;
+
+        // Return the orthonormal eigenvectors as the columns of V, column i belongs to values()[i].
+        // Throw logic_error if they were skipped.
+        const DenseMatrix& vectors() const;
+
+    private:
+        std::vector<double> _values;
+        DenseMatrix _vectors;
+        bool _has_vectors;
+    };
+
+    // Return the eigen-decomposition of the input symmetric matrix.
+    SymmetricEigen eigen_symmetric(const DenseMatrix& matrix, bool vectors = true);
+    SymmetricEigen eigen_symmetric(const Matrix& matrix, bool vectors = true);
+}
+
+#endif //SRC_EIGEN_H
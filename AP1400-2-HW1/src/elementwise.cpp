@@ -0,0 +1,218 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+#include "elementwise.h"
+// Last, the instructions of the variant apply to the code below it only.
+#include "isa.h"
+
+// The registers of the variant, the AVX2 and AVX-512 variants do not get the macros of their instructions.
+#if defined(ALGEBRA_ISA_AVX512) || defined(__AVX512F__)
+#define ELEMENTWISE_AVX512
+#elif defined(ALGEBRA_ISA_AVX2) || defined(__AVX__)
+#define ELEMENTWISE_AVX
+#elif defined(__SSE2__)
+#define ELEMENTWISE_SSE2
+#endif
+
+namespace algebra {
+    namespace kernel {
+        namespace ALGEBRA_ISA {
+            // The registers and instructions of the variant for each scalar type.
+            template <typename T>
+            struct Simd;
+
+#if defined(ELEMENTWISE_AVX512)
+            // 8 doubles or 16 floats per register.
+            template <>
+            struct Simd<double> {
+                static constexpr size_t width = 8;
+                using Vector = __m512d;
+                static Vector load(const double *p) { return _mm512_loadu_pd(p); }
+                static void store(double *p, Vector v) { _mm512_storeu_pd(p, v); }
+                static Vector broadcast(double c) { return _mm512_set1_pd(c); }
+                static Vector mul(Vector a, Vector b) { return _mm512_mul_pd(a, b); }
+                static Vector add(Vector a, Vector b) { return _mm512_add_pd(a, b); }
+                static Vector sub(Vector a, Vector b) { return _mm512_sub_pd(a, b); }
+            };
+
+            template <>
+            struct Simd<float> {
+                static constexpr size_t width = 16;
+                using Vector = __m512;
+                static Vector load(const float *p) { return _mm512_loadu_ps(p); }
+                static void store(float *p, Vector v) { _mm512_storeu_ps(p, v); }
+                static Vector broadcast(float c) { return _mm512_set1_ps(c); }
+                static Vector mul(Vector a, Vector b) { return _mm512_mul_ps(a, b); }
+                static Vector add(Vector a, Vector b) { return _mm512_add_ps(a, b); }
+                static Vector sub(Vector a, Vector b) { return _mm512_sub_ps(a, b); }
+            };
+            static const char *isa = "avx512";
+#elif defined(ELEMENTWISE_AVX)
+            // 4 doubles or 8 floats per register.
+            template <>
+            struct Simd<double> {
+                static constexpr size_t width = 4;
+                using Vector = __m256d;
+                static Vector load(const double *p) { return _mm256_loadu_pd(p); }
+                static void store(double *p, Vector v) { _mm256_storeu_pd(p, v); }
+                static Vector broadcast(double c) { return _mm256_set1_pd(c); }
+                static Vector mul(Vector a, Vector b) { return _mm256_mul_pd(a, b); }
+                static Vector add(Vector a, Vector b) { return _mm256_add_pd(a, b); }
+                static Vector sub(Vector a, Vector b) { return _mm256_sub_pd(a, b); }
+            };
+
+            template <>
+            struct Simd<float> {
+                static constexpr size_t width = 8;
+                using Vector = __m256;
+                static Vector load(const float *p) { return _mm256_loadu_ps(p); }
+                static void store(float *p, Vector v) { _mm256_storeu_ps(p, v); }
+                static Vector broadcast(float c) { return _mm256_set1_ps(c); }
+                static Vector mul(Vector a, Vector b) { return _mm256_mul_ps(a, b); }
+                static Vector add(Vector a, Vector b) { return _mm256_add_ps(a, b); }
+                static Vector sub(Vector a, Vector b) { return _mm256_sub_ps(a, b); }
+            };
+            static const char *isa = "avx2";
+#elif defined(ELEMENTWISE_SSE2)
+            // 2 doubles or 4 floats per register.
+            template <>
+            struct Simd<double> {
+                static constexpr size_t width = 2;
+                using Vector = __m128d;
+                static Vector load(const double *p) { return _mm_loadu_pd(p); }
+                static void store(double *p, Vector v) { _mm_storeu_pd(p, v); }
+                static Vector broadcast(double c) { return _mm_set1_pd(c); }
+                static Vector mul(Vector a, Vector b) { return _mm_mul_pd(a, b); }
+                static Vector add(Vector a, Vector b) { return _mm_add_pd(a, b); }
+                static Vector sub(Vector a, Vector b) { return _mm_sub_pd(a, b); }
+            };
+
+            template <>
+            struct Simd<float> {
+                static constexpr size_t width = 4;
+                using Vector = __m128;
+                static Vector load(const float *p) { return _mm_loadu_ps(p); }
+                static void store(float *p, Vector v) { _mm_storeu_ps(p, v); }
+                static Vector broadcast(float c) { return _mm_set1_ps(c); }
+                static Vector mul(Vector a, Vector b) { return _mm_mul_ps(a, b); }
+                static Vector add(Vector a, Vector b) { return _mm_add_ps(a, b); }
+                static Vector sub(Vector a, Vector b) { return _mm_sub_ps(a, b); }
+            };
+            static const char *isa = "sse2";
+#else
+            static const char *isa = "scalar";
+#endif
+
+            const char *elementwise_isa() {
+                return isa;
+            }
+
+            template <typename T>
+            static void scale_vectorized(const T *src, T c, T *dst, size_t n) {
+                size_t i = 0;
+#if defined(ELEMENTWISE_AVX512) || defined(ELEMENTWISE_AVX) || defined(ELEMENTWISE_SSE2)
+                using S = Simd<T>;
+                constexpr size_t width = S::width;
+                typename S::Vector vc = S::broadcast(c);
+                // Two registers per iteration to hide the latency.
+                for (; i + 2 * width <= n; i += 2 * width) {
+                    typename S::Vector x0 = S::load(src + i), x1 = S::load(src + i + width);
+                    S::store(dst + i, S::mul(x0, vc));
+                    S::store(dst + i + width, S::mul(x1, vc));
+                }
+                for (; i + width <= n; i += width) S::store(dst + i, S::mul(S::load(src + i), vc));
+#endif
+                // The tail which does not fill a register.
+                for (; i < n; i++) dst[i] = src[i] * c;
+            }
+
+            template <typename T>
+            static void shift_vectorized(const T *src, T c, T *dst, size_t n) {
+                size_t i = 0;
+#if defined(ELEMENTWISE_AVX512) || defined(ELEMENTWISE_AVX) || defined(ELEMENTWISE_SSE2)
+                using S = Simd<T>;
+                constexpr size_t width = S::width;
+                typename S::Vector vc = S::broadcast(c);
+                for (; i + 2 * width <= n; i += 2 * width) {
+                    typename S::Vector x0 = S::load(src + i), x1 = S::load(src + i + width);
+                    S::store(dst + i, S::add(x0, vc));
+                    S::store(dst + i + width, S::add(x1, vc));
+                }
+                for (; i + width <= n; i += width) S::store(dst + i, S::add(S::load(src + i), vc));
+#endif
+                for (; i < n; i++) dst[i] = src[i] + c;
+            }
+
+            template <typename T>
+            static void add_vectorized(const T *a, const T *b, T *dst, size_t n) {
+                size_t i = 0;
+#if defined(ELEMENTWISE_AVX512) || defined(ELEMENTWISE_AVX) || defined(ELEMENTWISE_SSE2)
+                using S = Simd<T>;
+                constexpr size_t width = S::width;
+                for (; i + 2 * width <= n; i += 2 * width) {
+                    typename S::Vector x0 = S::load(a + i), x1 = S::load(a + i + width);
+                    typename S::Vector y0 = S::load(b + i), y1 = S::load(b + i + width);
+                    S::store(dst + i, S::add(x0, y0));
+                    S::store(dst + i + width, S::add(x1, y1));
+                }
+                for (; i + width <= n; i += width) S::store(dst + i, S::add(S::load(a + i), S::load(b + i)));
+#endif
+                for (; i < n; i++) dst[i] = a[i] + b[i];
+            }
+
+            template <typename T>
+            static void subtract_vectorized(const T *a, const T *b, T *dst, size_t n) {
+                size_t i = 0;
+#if defined(ELEMENTWISE_AVX512) || defined(ELEMENTWISE_AVX) || defined(ELEMENTWISE_SSE2)
+                using S = Simd<T>;
+                constexpr size_t width = S::width;
+                for (; i + 2 * width <= n; i += 2 * width) {
+                    typename S::Vector x0 = S::load(a + i), x1 = S::load(a + i + width);
+                    typename S::Vector y0 = S::load(b + i), y1 = S::load(b + i + width);
+                    S::store(dst + i, S::sub(x0, y0));
+                    S::store(dst + i + width, S::sub(x1, y1));
+                }
+                for (; i + width <= n; i += width) S::store(dst + i, S::sub(S::load(a + i), S::load(b + i)));
+#endif
+                for (; i < n; i++) dst[i] = a[i] - b[i];
+            }
+
+            void scale(const double *src, double c, double *dst, size_t n) {
+                scale_vectorized(src, c, dst, n);
+            }
+
+            void scale(const float *src, float c, float *dst, size_t n) {
+                scale_vectorized(src, c, dst, n);
+            }
+
+            void shift(const double *src, double c, double *dst, size_t n) {
+                shift_vectorized(src, c, dst, n);
+            }
+
+            void shift(const float *src, float c, float *dst, size_t n) {
+                shift_vectorized(src, c, dst, n);
+            }
+
+            void add(const double *a, const double *b, double *dst, size_t n) {
+                add_vectorized(a, b, dst, n);
+            }
+
+            void add(const float *a, const float *b, float *dst, size_t n) {
+                add_vectorized(a, b, dst, n);
+            }
+
+            void subtract(const double *a, const double *b, double *dst, size_t n) {
+                subtract_vectorized(a, b, dst, n);
+            }
+
+            void subtract(const float *a, const float *b, float *dst, size_t n) {
+                subtract_vectorized(a, b, dst, n);
+            }
+        }
+    }
+}
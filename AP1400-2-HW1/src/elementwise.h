@@ -0,0 +1,37 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_ELEMENTWISE_H
+#define SRC_ELEMENTWISE_H
+
+#include <cstddef>
+
+// The vectorized element-wise kernels behind algebra::multiply and algebra::sum, for doubles and floats.
+// They use AVX-512, AVX or SSE2 by the variant picked in dispatch.h, and plain loops otherwise.
+// The output must be preallocated with at least n elements, it may alias an input.
+namespace algebra {
+    namespace kernel {
+        // Return the name of the instruction set of the selected variant.
+        const char *elementwise_isa();
+
+        // dst[i] = src[i] * c
+        void scale(const double *src, double c, double *dst, size_t n);
+        void scale(const float *src, float c, float *dst, size_t n);
+
+        // dst[i] = src[i] + c
+        void shift(const double *src, double c, double *dst, size_t n);
+        void shift(const float *src, float c, float *dst, size_t n);
+
+        // dst[i] = a[i] + b[i]
+        void add(const double *a, const double *b, double *dst, size_t n);
+        void add(const float *a, const float *b, float *dst, size_t n);
+
+        // dst[i] = a[i] - b[i]
+        void subtract(const double *a, const double *b, double *dst, size_t n);
+        void subtract(const float *a, const float *b, float *dst, size_t n);
+    }
+}
+
+#endif //SRC_ELEMENTWISE_H
@@ -0,0 +1,123 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#include <algorithm>
+#include <cmath>
+#include "elimination.h"
+#include "gemm.h"
+#include "thread_pool.h"
+#include "workspace.h"
+// Last, the instructions of the variant apply to the code below it only.
+#include "isa.h"
+
+using std::min;
+
+namespace algebra {
+    namespace kernel {
+        namespace ALGEBRA_ISA {
+            // The width of the column ranges shared between the threads when the rows of U are solved.
+            static constexpr size_t elimination_nc = 256;
+
+            // The panels narrower than this are eliminated column by column.
+            static constexpr size_t elimination_leaf = 16;
+
+            // Eliminate the columns [k0, k1) column by column over the rows [k0, n), the rows are swapped as a whole.
+            template <typename T>
+            static int factorize_columns(size_t n, size_t k0, size_t k1, T *a, size_t lda, size_t *pivot) {
+                int sign = 1;
+                for (size_t k = k0; k < k1; k++) {
+                    // Find the largest element in the column as the pivot.
+                    size_t p = k;
+                    for (size_t i = k + 1; i < n; i++)
+                        if (std::abs(a[i * lda + k]) > std::abs(a[p * lda + k])) p = i;
+                    // Swap the pivot row into place.
+                    if (p != k) {
+                        std::swap_ranges(a + k * lda, a + k * lda + n, a + p * lda);
+                        std::swap(pivot[k], pivot[p]);
+                        sign = -sign;
+                    }
+                    T value = a[k * lda + k];
+                    // Nothing to eliminate below an exact zero.
+                    if (value == 0) continue;
+                    // Only the columns up to k1 are updated, the rest waits for the blocked update.
+                    const T *row_k = a + k * lda;
+                    for (size_t i = k + 1; i < n; i++) {
+                        T *row_i = a + i * lda;
+                        T l = row_i[k] / value;
+                        row_i[k] = l;
+                        if (l == 0) continue;
+                        for (size_t j = k + 1; j < k1; j++) row_i[j] -= l * row_k[j];
+                    }
+                }
+                return sign;
+            }
+
+            // Solve L11 * U12 = A12 where L11 is the unit lower block of the rows and columns [k0, k1)
+            // and A12 the columns [j0, j1) of the same rows, each thread takes a range of columns.
+            template <typename T>
+            static void solve_rows(size_t k0, size_t k1, size_t j0, size_t j1, T *a, size_t lda) {
+                thread_pool().parallel_for((j1 - j0 + elimination_nc - 1) / elimination_nc, [&](size_t chunk) {
+                    size_t first = j0 + chunk * elimination_nc, last = min(j1, first + elimination_nc);
+                    for (size_t i = k0 + 1; i < k1; i++) {
+                        T *row_i = a + i * lda;
+                        for (size_t k = k0; k < i; k++) {
+                            T l = row_i[k];
+                            if (l == 0) continue;
+                            const T *row_k = a + k * lda;
+                            for (size_t j = first; j < last; j++) row_i[j] -= l * row_k[j];
+                        }
+                    }
+                });
+            }
+
+            // A22 -= L21 * U12 for the rows [k1, n) and the columns [j0, j1), the inner dimension is [k0, k1).
+            // The kernel only adds, so the negated multipliers are copied out.
+            template <typename T>
+            static void update_trailing(size_t n, size_t k0, size_t k1, size_t j0, size_t j1, T *a, size_t lda) {
+                size_t rows = n - k1, width = k1 - k0;
+                Scratch<T> lower(rows * width);
+                for (size_t i = 0; i < rows; i++)
+                    for (size_t k = 0; k < width; k++) lower[i * width + k] = -a[(k1 + i) * lda + k0 + k];
+                gemm_parallel(rows, j1 - j0, width, lower.data(), width,
+                              a + k0 * lda + j0, lda, a + k1 * lda + j0, lda);
+            }
+
+            // Eliminate the columns [k0, k1) over the rows [k0, n) by halves, so most of the work of a panel
+            // is done by the blocked product too.
+            template <typename T>
+            static int factorize_panel(size_t n, size_t k0, size_t k1, T *a, size_t lda, size_t *pivot) {
+                if (k1 - k0 <= elimination_leaf) return factorize_columns(n, k0, k1, a, lda, pivot);
+                size_t middle = k0 + (k1 - k0) / 2;
+                int sign = factorize_panel(n, k0, middle, a, lda, pivot);
+                solve_rows(k0, middle, middle, k1, a, lda);
+                update_trailing(n, k0, middle, middle, k1, a, lda);
+                return sign * factorize_panel(n, middle, k1, a, lda, pivot);
+            }
+
+            template <typename T>
+            static int eliminate_blocked(size_t n, T *a, size_t lda, size_t *pivot) {
+                for (size_t i = 0; i < n; i++) pivot[i] = i;
+                int sign = 1;
+                // Right-looking: factorize a panel, solve its rows of U, update everything right and below of it.
+                for (size_t k0 = 0; k0 < n; k0 += elimination_block) {
+                    size_t k1 = min(n, k0 + elimination_block);
+                    sign *= factorize_panel(n, k0, k1, a, lda, pivot);
+                    if (k1 == n) break;
+                    solve_rows(k0, k1, k1, n, a, lda);
+                    update_trailing(n, k0, k1, k1, n, a, lda);
+                }
+                return sign;
+            }
+
+            int eliminate(size_t n, double *a, size_t lda, size_t *pivot) {
+                return eliminate_blocked(n, a, lda, pivot);
+            }
+
+            int eliminate(size_t n, float *a, size_t lda, size_t *pivot) {
+                return eliminate_blocked(n, a, lda, pivot);
+            }
+        }
+    }
+}
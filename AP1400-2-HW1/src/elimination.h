@@ -0,0 +1,28 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_ELIMINATION_H
+#define SRC_ELIMINATION_H
+
+#include <cstddef>
+
+// The blocked Gaussian elimination behind algebra::upper_triangular and algebra::LU.
+namespace algebra {
+    namespace kernel {
+        // The number of columns eliminated by one panel before the trailing rows are updated.
+        constexpr size_t elimination_block = 128;
+
+        // Factorize the n*n row-major A in place into P * A = L * U by partial pivoting.
+        // U is left on and above the diagonal, the multipliers of the unit lower L below it.
+        // Row i of P * A is row pivot[i] of A, pivot must hold n elements.
+        // A column whose pivot is exactly zero is skipped. Return the parity of P, 1 or -1.
+        // The panels are eliminated right-looking: a panel of elimination_block columns is factorized,
+        // its rows of U are solved, then the trailing submatrix is updated by one product on the thread pool.
+        int eliminate(size_t n, double *a, size_t lda, size_t *pivot);
+        int eliminate(size_t n, float *a, size_t lda, size_t *pivot);
+    }
+}
+
+#endif //SRC_ELIMINATION_H
@@ -0,0 +1,143 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_EXPRESSION_H
+#define SRC_EXPRESSION_H
+
+#include "dense_matrix.h"
+
+// Lazy element-wise arithmetic on matrices.
+// An expression like 2.0 * lazy(a) + transpose(lazy(b)) * 3.0 builds a small tree of
+// nodes and nothing is computed until evaluate() runs one fused loop into the result,
+// so no intermediate matrix is allocated.
+// The leaves keep references to the matrices, evaluate the expression before they go away.
+namespace algebra {
+    namespace expression {
+        // The base of all nodes, E is the node type itself (CRTP).
+        template <typename E>
+        class Expression {
+        public:
+            // Return the node as its real type.
+            const E &self() const;
+
+            // Return the shape of the result.
+            size_t rows() const;
+            size_t cols() const;
+
+            // Return the element of the result at rth row and cth column.
+            double operator()(size_t r, size_t c) const;
+        };
+
+        // A leaf which reads a DenseMatrix.
+        class DenseRef : public Expression<DenseRef> {
+        public:
+            explicit DenseRef(const DenseMatrix &matrix);
+            size_t rows() const;
+            size_t cols() const;
+            double operator()(size_t r, size_t c) const;
+
+        private:
+            const DenseMatrix &_matrix;
+        };
+
+        // A leaf which reads a vector-of-vectors Matrix.
+        class MatrixRef : public Expression<MatrixRef> {
+        public:
+            explicit MatrixRef(const Matrix &matrix);
+            size_t rows() const;
+            size_t cols() const;
+            double operator()(size_t r, size_t c) const;
+
+        private:
+            const Matrix &_matrix;
+        };
+
+        // The node of e * c.
+        template <typename E>
+        class Scale : public Expression<Scale<E>> {
+        public:
+            Scale(const E &e, double c);
+            size_t rows() const;
+            size_t cols() const;
+            double operator()(size_t r, size_t c) const;
+
+        private:
+            E _e;
+            double _c;
+        };
+
+        // The node of e + c.
+        template <typename E>
+        class Shift : public Expression<Shift<E>> {
+        public:
+            Shift(const E &e, double c);
+            size_t rows() const;
+            size_t cols() const;
+            double operator()(size_t r, size_t c) const;
+
+        private:
+            E _e;
+            double _c;
+        };
+
+        // The node of l + r, both sides must have the same shape.
+        template <typename L, typename R>
+        class Sum : public Expression<Sum<L, R>> {
+        public:
+            // Throw logic_error if the shapes are different.
+            Sum(const L &l, const R &r);
+            size_t rows() const;
+            size_t cols() const;
+            double operator()(size_t r, size_t c) const;
+
+        private:
+            L _l;
+            R _r;
+        };
+
+        // The node of the transpose of e.
+        template <typename E>
+        class Transpose : public Expression<Transpose<E>> {
+        public:
+            explicit Transpose(const E &e);
+            size_t rows() const;
+            size_t cols() const;
+            double operator()(size_t r, size_t c) const;
+
+        private:
+            E _e;
+        };
+
+        // Return the leaf of the given matrix.
+        DenseRef lazy(const DenseMatrix &matrix);
+        MatrixRef lazy(const Matrix &matrix);
+
+        // Build the nodes, nothing is computed here.
+        template <typename E>
+        Scale<E> operator*(const Expression<E> &e, double c);
+
+        template <typename E>
+        Scale<E> operator*(double c, const Expression<E> &e);
+
+        template <typename E>
+        Shift<E> operator+(const Expression<E> &e, double c);
+
+        template <typename E>
+        Shift<E> operator+(double c, const Expression<E> &e);
+
+        template <typename L, typename R>
+        Sum<L, R> operator+(const Expression<L> &l, const Expression<R> &r);
+
+        template <typename E>
+        Transpose<E> transpose(const Expression<E> &e);
+
+        // Compute the whole expression in one loop into a new matrix.
+        template <typename E>
+        DenseMatrix evaluate(const Expression<E> &e);
+    }
+}
+
+#include "expression.hpp"
+#endif //SRC_EXPRESSION_H
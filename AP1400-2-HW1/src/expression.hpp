@@ -0,0 +1,194 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_EXPRESSION_HPP
+#define SRC_EXPRESSION_HPP
+
+#include <stdexcept>
+
+namespace algebra {
+    namespace expression {
+        template <typename E>
+        const E &Expression<E>::self() const {
+            return static_cast<const E &>(*this);
+        }
+
+        template <typename E>
+        size_t Expression<E>::rows() const {
+            return self().rows();
+        }
+
+        template <typename E>
+        size_t Expression<E>::cols() const {
+            return self().cols();
+        }
+
+        template <typename E>
+        double Expression<E>::operator()(size_t r, size_t c) const {
+            return self()(r, c);
+        }
+
+        inline DenseRef::DenseRef(const DenseMatrix &matrix) : _matrix(matrix) {}
+
+        inline size_t DenseRef::rows() const {
+            return _matrix.rows();
+        }
+
+        inline size_t DenseRef::cols() const {
+            return _matrix.cols();
+        }
+
+        inline double DenseRef::operator()(size_t r, size_t c) const {
+            return _matrix(r, c);
+        }
+
+        inline MatrixRef::MatrixRef(const Matrix &matrix) : _matrix(matrix) {
+            // Check if all rows have the same length.
+            for (const auto &row : matrix)
+                if (row.size() != matrix[0].size()) throw std::logic_error("All rows should have the same length.");
+        }
+
+        inline size_t MatrixRef::rows() const {
+            return _matrix.size();
+        }
+
+        inline size_t MatrixRef::cols() const {
+            return _matrix.empty() ? 0 : _matrix[0].size();
+        }
+
+        inline double MatrixRef::operator()(size_t r, size_t c) const {
+            return _matrix[r][c];
+        }
+
+        template <typename E>
+        Scale<E>::Scale(const E &e, double c) : _e(e), _c(c) {}
+
+        template <typename E>
+        size_t Scale<E>::rows() const {
+            return _e.rows();
+        }
+
+        template <typename E>
+        size_t Scale<E>::cols() const {
+            return _e.cols();
+        }
+
+        template <typename E>
+        double Scale<E>::operator()(size_t r, size_t c) const {
+            return _e(r, c) * _c;
+        }
+
+        template <typename E>
+        Shift<E>::Shift(const E &e, double c) : _e(e), _c(c) {}
+
+        template <typename E>
+        size_t Shift<E>::rows() const {
+            return _e.rows();
+        }
+
+        template <typename E>
+        size_t Shift<E>::cols() const {
+            return _e.cols();
+        }
+
+        template <typename E>
+        double Shift<E>::operator()(size_t r, size_t c) const {
+            return _e(r, c) + _c;
+        }
+
+        template <typename L, typename R>
+        Sum<L, R>::Sum(const L &l, const R &r) : _l(l), _r(r) {
+            // Check if both sides have same dimensions.
+            if (l.rows() != r.rows() || l.cols() != r.cols())
+                throw std::logic_error("Both matrices must have the same dimensions.");
+        }
+
+        template <typename L, typename R>
+        size_t Sum<L, R>::rows() const {
+            return _l.rows();
+        }
+
+        template <typename L, typename R>
+        size_t Sum<L, R>::cols() const {
+            return _l.cols();
+        }
+
+        template <typename L, typename R>
+        double Sum<L, R>::operator()(size_t r, size_t c) const {
+            return _l(r, c) + _r(r, c);
+        }
+
+        template <typename E>
+        Transpose<E>::Transpose(const E &e) : _e(e) {}
+
+        template <typename E>
+        size_t Transpose<E>::rows() const {
+            return _e.cols();
+        }
+
+        template <typename E>
+        size_t Transpose<E>::cols() const {
+            return _e.rows();
+        }
+
+        template <typename E>
+        double Transpose<E>::operator()(size_t r, size_t c) const {
+            return _e(c, r);
+        }
+
+        inline DenseRef lazy(const DenseMatrix &matrix) {
+            return DenseRef(matrix);
+        }
+
+        inline MatrixRef lazy(const Matrix &matrix) {
+            return MatrixRef(matrix);
+        }
+
+        template <typename E>
+        Scale<E> operator*(const Expression<E> &e, double c) {
+            return Scale<E>(e.self(), c);
+        }
+
+        template <typename E>
+        Scale<E> operator*(double c, const Expression<E> &e) {
+            return Scale<E>(e.self(), c);
+        }
+
+        template <typename E>
+        Shift<E> operator+(const Expression<E> &e, double c) {
+            return Shift<E>(e.self(), c);
+        }
+
+        template <typename E>
+        Shift<E> operator+(double c, const Expression<E> &e) {
+            return Shift<E>(e.self(), c);
+        }
+
+        template <typename L, typename R>
+        Sum<L, R> operator+(const Expression<L> &l, const Expression<R> &r) {
+            return Sum<L, R>(l.self(), r.self());
+        }
+
+        template <typename E>
+        Transpose<E> transpose(const Expression<E> &e) {
+            return Transpose<E>(e.self());
+        }
+
+        template <typename E>
+        DenseMatrix evaluate(const Expression<E> &e) {
+            const E &expr = e.self();
+            // The result is the only allocation.
+            DenseMatrix res(expr.rows(), expr.cols());
+            // One fused pass, every node is inlined into the loop body.
+            for (size_t i = 0; i < res.rows(); i++) {
+                double *row = res.row(i);
+                for (size_t j = 0; j < res.cols(); j++) row[j] = expr(i, j);
+            }
+            return res;
+        }
+    }
+}
+
+#endif //SRC_EXPRESSION_HPP
@@ -0,0 +1,90 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_FIXED_MATRIX_H
+#define SRC_FIXED_MATRIX_H
+
+#include <initializer_list>
+#include "dense_matrix.h"
+
+namespace algebra {
+    // A small R*C matrix whose shape is known at compile time, from 1*1 up to 8*8.
+    // The elements live inside the object, so it never allocates and can be used in constant expressions.
+    // The functions below are unrolled for the exact shape, with closed forms up to 4*4.
+    template <size_t R, size_t C>
+    class FixedMatrix {
+        static_assert(R >= 1 && R <= 8 && C >= 1 && C <= 8, "A FixedMatrix has 1 to 8 rows and columns.");
+
+    public:
+        // Default constructor that creates a matrix with all elements equal to zero.
+        constexpr FixedMatrix();
+
+        // Constructor that takes the rows as nested lists.
+        // Throw logic_error if the shape is not R*C.
+        constexpr FixedMatrix(std::initializer_list<std::initializer_list<double>> list);
+
+        // Convert from the other matrix types, throw logic_error if the shape is not R*C.
+        explicit FixedMatrix(const DenseMatrix &matrix);
+        explicit FixedMatrix(const Matrix &matrix);
+
+        // Return the matrix of the given R*C elements in row-major order.
+        template <typename... T>
+        static constexpr FixedMatrix from_elements(T... values);
+
+        // Return the shape.
+        static constexpr size_t rows() { return R; }
+        static constexpr size_t cols() { return C; }
+
+        // Return the element at rth row and cth column, no bound check.
+        constexpr double &operator()(size_t r, size_t c) { return _data[r * C + c]; }
+        constexpr double operator()(size_t r, size_t c) const { return _data[r * C + c]; }
+
+        // Return the pointer to the first element, the rows are contiguous.
+        double *data() { return _data; }
+        const double *data() const { return _data; }
+
+        // Convert to the other matrix types, costs a single allocation.
+        DenseMatrix to_dense() const;
+        Matrix to_matrix() const;
+
+        constexpr bool operator==(const FixedMatrix &other) const;
+        constexpr bool operator!=(const FixedMatrix &other) const;
+
+    private:
+        double _data[R * C];
+    };
+
+    // Return a new matrix that multiplies the given matrix1 into given matrix2.
+    template <size_t R, size_t K, size_t C>
+    constexpr FixedMatrix<R, C> multiply(const FixedMatrix<R, K> &matrix1, const FixedMatrix<K, C> &matrix2);
+
+    // Return a new matrix that multiplies the given matrix into the given constant scalar c.
+    template <size_t R, size_t C>
+    constexpr FixedMatrix<R, C> multiply(const FixedMatrix<R, C> &matrix, double c);
+
+    // Return a new matrix that adds the constant number c to every element of given matrix.
+    template <size_t R, size_t C>
+    constexpr FixedMatrix<R, C> sum(const FixedMatrix<R, C> &matrix, double c);
+
+    // Return a new matrix that adds 2 matrices to each other.
+    template <size_t R, size_t C>
+    constexpr FixedMatrix<R, C> sum(const FixedMatrix<R, C> &matrix1, const FixedMatrix<R, C> &matrix2);
+
+    // Return a transpose matrix of the input matrix.
+    template <size_t R, size_t C>
+    constexpr FixedMatrix<C, R> transpose(const FixedMatrix<R, C> &matrix);
+
+    // Return the calculation of the determinant of the input matrix.
+    template <size_t N>
+    constexpr double determinant(const FixedMatrix<N, N> &matrix);
+
+    // Return the matrix's inverse.
+    // Throw logic_error if the matrix is singular, with the same tolerance as the LU factorization.
+    template <size_t N>
+    constexpr FixedMatrix<N, N> inverse(const FixedMatrix<N, N> &matrix);
+}
+
+#include "fixed_matrix.hpp"
+#endif //SRC_FIXED_MATRIX_H
@@ -0,0 +1,330 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_FIXED_MATRIX_HPP
+#define SRC_FIXED_MATRIX_HPP
+
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace algebra {
+    template <size_t R, size_t C>
+    constexpr FixedMatrix<R, C>::FixedMatrix() : _data{} {}
+
+    template <size_t R, size_t C>
+    constexpr FixedMatrix<R, C>::FixedMatrix(std::initializer_list<std::initializer_list<double>> list) : _data{} {
+        if (list.size() != R) throw std::logic_error("The matrix has the wrong number of rows.");
+        size_t i = 0;
+        for (const auto &row : list) {
+            if (row.size() != C) throw std::logic_error("The matrix has the wrong number of columns.");
+            size_t j = 0;
+            for (double value : row) _data[i * C + j++] = value;
+            i++;
+        }
+    }
+
+    template <size_t R, size_t C>
+    FixedMatrix<R, C>::FixedMatrix(const DenseMatrix &matrix) : _data{} {
+        if (matrix.rows() != R || matrix.cols() != C) throw std::logic_error("The matrix has the wrong shape.");
+        for (size_t i = 0; i < R; i++)
+            for (size_t j = 0; j < C; j++) _data[i * C + j] = matrix(i, j);
+    }
+
+    template <size_t R, size_t C>
+    FixedMatrix<R, C>::FixedMatrix(const Matrix &matrix) : _data{} {
+        if (matrix.size() != R) throw std::logic_error("The matrix has the wrong shape.");
+        for (size_t i = 0; i < R; i++) {
+            if (matrix[i].size() != C) throw std::logic_error("The matrix has the wrong shape.");
+            for (size_t j = 0; j < C; j++) _data[i * C + j] = matrix[i][j];
+        }
+    }
+
+    template <size_t R, size_t C>
+    template <typename... T>
+    constexpr FixedMatrix<R, C> FixedMatrix<R, C>::from_elements(T... values) {
+        static_assert(sizeof...(T) == R * C, "A FixedMatrix needs exactly R*C elements.");
+        FixedMatrix res;
+        const double elements[]{static_cast<double>(values)...};
+        for (size_t i = 0; i < R * C; i++) res._data[i] = elements[i];
+        return res;
+    }
+
+    template <size_t R, size_t C>
+    DenseMatrix FixedMatrix<R, C>::to_dense() const {
+        DenseMatrix res(R, C);
+        for (size_t i = 0; i < R; i++)
+            for (size_t j = 0; j < C; j++) res(i, j) = _data[i * C + j];
+        return res;
+    }
+
+    template <size_t R, size_t C>
+    Matrix FixedMatrix<R, C>::to_matrix() const {
+        Matrix res(R);
+        for (size_t i = 0; i < R; i++) res[i].assign(_data + i * C, _data + (i + 1) * C);
+        return res;
+    }
+
+    template <size_t R, size_t C>
+    constexpr bool FixedMatrix<R, C>::operator==(const FixedMatrix &other) const {
+        for (size_t i = 0; i < R * C; i++)
+            if (_data[i] != other._data[i]) return false;
+        return true;
+    }
+
+    template <size_t R, size_t C>
+    constexpr bool FixedMatrix<R, C>::operator!=(const FixedMatrix &other) const {
+        return !(*this == other);
+    }
+
+    // The helpers below expand a pack of indices into one expression per element,
+    // so the compiler sees straight-line code for the exact shape.
+    namespace fixed {
+        // Return the sum of the values, left to right.
+        constexpr double sum_of(std::initializer_list<double> values) {
+            double res = 0;
+            for (double value : values) res += value;
+            return res;
+        }
+
+        constexpr double abs(double x) {
+            return x < 0 ? -x : x;
+        }
+
+        // Return the largest absolute value of the elements.
+        template <size_t R, size_t C>
+        constexpr double max_abs(const FixedMatrix<R, C> &matrix) {
+            double res = 0;
+            for (size_t i = 0; i < R; i++)
+                for (size_t j = 0; j < C; j++) res = abs(matrix(i, j)) > res ? abs(matrix(i, j)) : res;
+            return res;
+        }
+
+        // Return the dot product of row i of matrix1 and column j of matrix2.
+        template <size_t R, size_t K, size_t C, size_t... P>
+        constexpr double dot(const FixedMatrix<R, K> &matrix1, const FixedMatrix<K, C> &matrix2, size_t i, size_t j,
+                             std::index_sequence<P...>) {
+            return sum_of({matrix1(i, P) * matrix2(P, j)...});
+        }
+
+        template <size_t R, size_t K, size_t C, size_t... I>
+        constexpr FixedMatrix<R, C> multiply(const FixedMatrix<R, K> &matrix1, const FixedMatrix<K, C> &matrix2,
+                                             std::index_sequence<I...>) {
+            return FixedMatrix<R, C>::from_elements(dot(matrix1, matrix2, I / C, I % C,
+                                                        std::make_index_sequence<K>())...);
+        }
+
+        template <size_t R, size_t C, size_t... I>
+        constexpr FixedMatrix<R, C> scale(const FixedMatrix<R, C> &matrix, double c, std::index_sequence<I...>) {
+            return FixedMatrix<R, C>::from_elements(matrix(I / C, I % C) * c...);
+        }
+
+        template <size_t R, size_t C, size_t... I>
+        constexpr FixedMatrix<R, C> shift(const FixedMatrix<R, C> &matrix, double c, std::index_sequence<I...>) {
+            return FixedMatrix<R, C>::from_elements(matrix(I / C, I % C) + c...);
+        }
+
+        template <size_t R, size_t C, size_t... I>
+        constexpr FixedMatrix<R, C> add(const FixedMatrix<R, C> &matrix1, const FixedMatrix<R, C> &matrix2,
+                                        std::index_sequence<I...>) {
+            return FixedMatrix<R, C>::from_elements(matrix1(I / C, I % C) + matrix2(I / C, I % C)...);
+        }
+
+        template <size_t R, size_t C, size_t... I>
+        constexpr FixedMatrix<C, R> transpose(const FixedMatrix<R, C> &matrix, std::index_sequence<I...>) {
+            return FixedMatrix<C, R>::from_elements(matrix(I % R, I / R)...);
+        }
+
+        // Throw logic_error if the determinant is negligible, the same test as a pivot of the LU factorization
+        // applied to the product of all the pivots.
+        template <size_t N>
+        constexpr double check_invertible(const FixedMatrix<N, N> &matrix, double det) {
+            double scale = max_abs(matrix), bound = N * std::numeric_limits<double>::epsilon();
+            for (size_t i = 0; i < N; i++) bound *= scale;
+            if (abs(det) <= bound) throw std::logic_error("Matrix is not invertible.");
+            return det;
+        }
+
+        // The closed forms up to 4*4, by cofactors.
+        constexpr double determinant(const FixedMatrix<1, 1> &a) {
+            return a(0, 0);
+        }
+
+        constexpr double determinant(const FixedMatrix<2, 2> &a) {
+            return a(0, 0) * a(1, 1) - a(0, 1) * a(1, 0);
+        }
+
+        constexpr double determinant(const FixedMatrix<3, 3> &a) {
+            return a(0, 0) * (a(1, 1) * a(2, 2) - a(1, 2) * a(2, 1)) -
+                   a(0, 1) * (a(1, 0) * a(2, 2) - a(1, 2) * a(2, 0)) +
+                   a(0, 2) * (a(1, 0) * a(2, 1) - a(1, 1) * a(2, 0));
+        }
+
+        // The 2*2 minors of the top two rows (s) and of the bottom two rows (c), shared by the 4*4 forms.
+        struct Minors4 {
+            double s0, s1, s2, s3, s4, s5, c0, c1, c2, c3, c4, c5;
+
+            constexpr explicit Minors4(const FixedMatrix<4, 4> &a)
+                    : s0(a(0, 0) * a(1, 1) - a(1, 0) * a(0, 1)), s1(a(0, 0) * a(1, 2) - a(1, 0) * a(0, 2)),
+                      s2(a(0, 0) * a(1, 3) - a(1, 0) * a(0, 3)), s3(a(0, 1) * a(1, 2) - a(1, 1) * a(0, 2)),
+                      s4(a(0, 1) * a(1, 3) - a(1, 1) * a(0, 3)), s5(a(0, 2) * a(1, 3) - a(1, 2) * a(0, 3)),
+                      c0(a(2, 0) * a(3, 1) - a(3, 0) * a(2, 1)), c1(a(2, 0) * a(3, 2) - a(3, 0) * a(2, 2)),
+                      c2(a(2, 0) * a(3, 3) - a(3, 0) * a(2, 3)), c3(a(2, 1) * a(3, 2) - a(3, 1) * a(2, 2)),
+                      c4(a(2, 1) * a(3, 3) - a(3, 1) * a(2, 3)), c5(a(2, 2) * a(3, 3) - a(3, 2) * a(2, 3)) {}
+
+            constexpr double determinant() const {
+                return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+            }
+        };
+
+        constexpr double determinant(const FixedMatrix<4, 4> &a) {
+            return Minors4(a).determinant();
+        }
+
+        // From 5*5 on, Gaussian elimination with partial pivoting.
+        template <size_t N>
+        constexpr double determinant(const FixedMatrix<N, N> &matrix) {
+            FixedMatrix<N, N> a = matrix;
+            double res = 1;
+            for (size_t k = 0; k < N; k++) {
+                size_t p = k;
+                for (size_t i = k + 1; i < N; i++)
+                    if (abs(a(i, k)) > abs(a(p, k))) p = i;
+                if (a(p, k) == 0) return 0;
+                if (p != k) {
+                    for (size_t j = k; j < N; j++) {
+                        double t = a(k, j);
+                        a(k, j) = a(p, j);
+                        a(p, j) = t;
+                    }
+                    res = -res;
+                }
+                res *= a(k, k);
+                for (size_t i = k + 1; i < N; i++) {
+                    double f = a(i, k) / a(k, k);
+                    for (size_t j = k + 1; j < N; j++) a(i, j) -= f * a(k, j);
+                }
+            }
+            return res;
+        }
+
+        constexpr FixedMatrix<1, 1> inverse(const FixedMatrix<1, 1> &a) {
+            return FixedMatrix<1, 1>::from_elements(1 / check_invertible(a, a(0, 0)));
+        }
+
+        constexpr FixedMatrix<2, 2> inverse(const FixedMatrix<2, 2> &a) {
+            double r = 1 / check_invertible(a, determinant(a));
+            return FixedMatrix<2, 2>::from_elements(a(1, 1) * r, -a(0, 1) * r, -a(1, 0) * r, a(0, 0) * r);
+        }
+
+        // The adjugate divided by the determinant.
+        constexpr FixedMatrix<3, 3> inverse(const FixedMatrix<3, 3> &a) {
+            double c00 = a(1, 1) * a(2, 2) - a(1, 2) * a(2, 1);
+            double c10 = a(1, 2) * a(2, 0) - a(1, 0) * a(2, 2);
+            double c20 = a(1, 0) * a(2, 1) - a(1, 1) * a(2, 0);
+            double r = 1 / check_invertible(a, a(0, 0) * c00 + a(0, 1) * c10 + a(0, 2) * c20);
+            return FixedMatrix<3, 3>::from_elements(
+                    c00 * r, (a(0, 2) * a(2, 1) - a(0, 1) * a(2, 2)) * r, (a(0, 1) * a(1, 2) - a(0, 2) * a(1, 1)) * r,
+                    c10 * r, (a(0, 0) * a(2, 2) - a(0, 2) * a(2, 0)) * r, (a(0, 2) * a(1, 0) - a(0, 0) * a(1, 2)) * r,
+                    c20 * r, (a(0, 1) * a(2, 0) - a(0, 0) * a(2, 1)) * r, (a(0, 0) * a(1, 1) - a(0, 1) * a(1, 0)) * r);
+        }
+
+        // The adjugate from the shared 2*2 minors, divided by the determinant.
+        constexpr FixedMatrix<4, 4> inverse(const FixedMatrix<4, 4> &a) {
+            Minors4 m(a);
+            double r = 1 / check_invertible(a, m.determinant());
+            return FixedMatrix<4, 4>::from_elements(
+                    (a(1, 1) * m.c5 - a(1, 2) * m.c4 + a(1, 3) * m.c3) * r,
+                    (-a(0, 1) * m.c5 + a(0, 2) * m.c4 - a(0, 3) * m.c3) * r,
+                    (a(3, 1) * m.s5 - a(3, 2) * m.s4 + a(3, 3) * m.s3) * r,
+                    (-a(2, 1) * m.s5 + a(2, 2) * m.s4 - a(2, 3) * m.s3) * r,
+                    (-a(1, 0) * m.c5 + a(1, 2) * m.c2 - a(1, 3) * m.c1) * r,
+                    (a(0, 0) * m.c5 - a(0, 2) * m.c2 + a(0, 3) * m.c1) * r,
+                    (-a(3, 0) * m.s5 + a(3, 2) * m.s2 - a(3, 3) * m.s1) * r,
+                    (a(2, 0) * m.s5 - a(2, 2) * m.s2 + a(2, 3) * m.s1) * r,
+                    (a(1, 0) * m.c4 - a(1, 1) * m.c2 + a(1, 3) * m.c0) * r,
+                    (-a(0, 0) * m.c4 + a(0, 1) * m.c2 - a(0, 3) * m.c0) * r,
+                    (a(3, 0) * m.s4 - a(3, 1) * m.s2 + a(3, 3) * m.s0) * r,
+                    (-a(2, 0) * m.s4 + a(2, 1) * m.s2 - a(2, 3) * m.s0) * r,
+                    (-a(1, 0) * m.c3 + a(1, 1) * m.c1 - a(1, 2) * m.c0) * r,
+                    (a(0, 0) * m.c3 - a(0, 1) * m.c1 + a(0, 2) * m.c0) * r,
+                    (-a(3, 0) * m.s3 + a(3, 1) * m.s1 - a(3, 2) * m.s0) * r,
+                    (a(2, 0) * m.s3 - a(2, 1) * m.s1 + a(2, 2) * m.s0) * r);
+        }
+
+        // From 5*5 on, Gauss-Jordan elimination with partial pivoting on [A | I].
+        template <size_t N>
+        constexpr FixedMatrix<N, N> inverse(const FixedMatrix<N, N> &matrix) {
+            FixedMatrix<N, N> a = matrix, res;
+            for (size_t i = 0; i < N; i++) res(i, i) = 1;
+            double bound = N * std::numeric_limits<double>::epsilon() * max_abs(matrix);
+            for (size_t k = 0; k < N; k++) {
+                size_t p = k;
+                for (size_t i = k + 1; i < N; i++)
+                    if (abs(a(i, k)) > abs(a(p, k))) p = i;
+                if (abs(a(p, k)) <= bound) throw std::logic_error("Matrix is not invertible.");
+                for (size_t j = 0; j < N; j++) {
+                    double t = a(k, j);
+                    a(k, j) = a(p, j);
+                    a(p, j) = t;
+                    t = res(k, j);
+                    res(k, j) = res(p, j);
+                    res(p, j) = t;
+                }
+                double r = 1 / a(k, k);
+                for (size_t j = 0; j < N; j++) {
+                    a(k, j) *= r;
+                    res(k, j) *= r;
+                }
+                for (size_t i = 0; i < N; i++) {
+                    if (i == k) continue;
+                    double f = a(i, k);
+                    for (size_t j = 0; j < N; j++) {
+                        a(i, j) -= f * a(k, j);
+                        res(i, j) -= f * res(k, j);
+                    }
+                }
+            }
+            return res;
+        }
+    }
+
+    template <size_t R, size_t K, size_t C>
+    constexpr FixedMatrix<R, C> multiply(const FixedMatrix<R, K> &matrix1, const FixedMatrix<K, C> &matrix2) {
+        return fixed::multiply(matrix1, matrix2, std::make_index_sequence<R * C>());
+    }
+
+    template <size_t R, size_t C>
+    constexpr FixedMatrix<R, C> multiply(const FixedMatrix<R, C> &matrix, double c) {
+        return fixed::scale(matrix, c, std::make_index_sequence<R * C>());
+    }
+
+    template <size_t R, size_t C>
+    constexpr FixedMatrix<R, C> sum(const FixedMatrix<R, C> &matrix, double c) {
+        return fixed::shift(matrix, c, std::make_index_sequence<R * C>());
+    }
+
+    template <size_t R, size_t C>
+    constexpr FixedMatrix<R, C> sum(const FixedMatrix<R, C> &matrix1, const FixedMatrix<R, C> &matrix2) {
+        return fixed::add(matrix1, matrix2, std::make_index_sequence<R * C>());
+    }
+
+    template <size_t R, size_t C>
+    constexpr FixedMatrix<C, R> transpose(const FixedMatrix<R, C> &matrix) {
+        return fixed::transpose(matrix, std::make_index_sequence<R * C>());
+    }
+
+    template <size_t N>
+    constexpr double determinant(const FixedMatrix<N, N> &matrix) {
+        return fixed::determinant(matrix);
+    }
+
+    template <size_t N>
+    constexpr FixedMatrix<N, N> inverse(const FixedMatrix<N, N> &matrix) {
+        return fixed::inverse(matrix);
+    }
+}
+
+#endif //SRC_FIXED_MATRIX_HPP
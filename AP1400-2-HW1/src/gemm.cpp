@@ -0,0 +1,204 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#include <algorithm>
+#include <cstring>
+#include "gemm.h"
+#include "thread_pool.h"
+#include "workspace.h"
+// Last, the instructions of the variant apply to the code below it only.
+#include "isa.h"
+
+using std::min;
+
+namespace algebra {
+    namespace kernel {
+        namespace ALGEBRA_ISA {
+            // Pack a mc*kc block of A into strips of mr rows, converting the elements to the type of the product.
+            // Every strip is stored column by column, the missing rows of the last strip are zero.
+            template <typename In, typename Acc>
+            static void pack_a(size_t mc, size_t kc, const In *a, size_t lda, Acc *buffer) {
+                for (size_t i = 0; i < mc; i += gemm_mr) {
+                    size_t mr = min(gemm_mr, mc - i);
+                    for (size_t p = 0; p < kc; p++) {
+                        for (size_t r = 0; r < mr; r++) *buffer++ = a[(i + r) * lda + p];
+                        for (size_t r = mr; r < gemm_mr; r++) *buffer++ = 0;
+                    }
+                }
+            }
+
+            // Pack a kc*nc panel of B into slivers of nr columns.
+            // Every sliver is stored row by row, the missing columns of the last sliver are zero.
+            template <typename In, typename Acc>
+            static void pack_b(size_t kc, size_t nc, const In *b, size_t ldb, Acc *buffer) {
+                for (size_t j = 0; j < nc; j += gemm_nr) {
+                    size_t nr = min(gemm_nr, nc - j);
+                    for (size_t p = 0; p < kc; p++) {
+                        const In *src = b + p * ldb + j;
+                        for (size_t c = 0; c < nr; c++) *buffer++ = src[c];
+                        for (size_t c = nr; c < gemm_nr; c++) *buffer++ = 0;
+                    }
+                }
+            }
+
+            // Compute a mr*nr tile of C from a packed strip of A and a packed sliver of B.
+            // The accumulators are kept in registers, only the valid mr*nr part is written back.
+            template <typename Acc>
+            static void micro_kernel(size_t kc, const Acc *a, const Acc *b,
+                                     Acc *c, size_t ldc, size_t mr, size_t nr) {
+#if defined(__GNUC__) && ALGEBRA_ISA_BYTES > 16
+                // In the wide variants a row of the tile is split into vectors of the register width, the
+                // auto-vectorizer of GCC shuffles the plain 2D tile of floats around with AVX-512.
+                constexpr size_t bytes = min<size_t>(ALGEBRA_ISA_BYTES, gemm_nr * sizeof(Acc));
+                constexpr size_t parts = gemm_nr * sizeof(Acc) / bytes;
+                typedef Acc Vector __attribute__((vector_size(bytes)));
+                // The packed panels are only aligned on their elements.
+                typedef Acc Unaligned __attribute__((vector_size(bytes), aligned(sizeof(Acc)), may_alias));
+                Vector acc[gemm_mr][parts] = {};
+                for (size_t p = 0; p < kc; p++) {
+                    // Rank-1 update of the tile by one column of A and one row of B.
+                    Vector row[parts];
+                    for (size_t q = 0; q < parts; q++)
+                        row[q] = reinterpret_cast<const Unaligned *>(b)[q];
+                    for (size_t i = 0; i < gemm_mr; i++)
+                        for (size_t q = 0; q < parts; q++) acc[i][q] += a[i] * row[q];
+                    a += gemm_mr;
+                    b += gemm_nr;
+                }
+                Acc tile[gemm_mr][gemm_nr];
+                std::memcpy(tile, acc, sizeof(tile));
+                for (size_t i = 0; i < mr; i++)
+                    for (size_t j = 0; j < nr; j++) c[i * ldc + j] += tile[i][j];
+#else
+                Acc acc[gemm_mr][gemm_nr] = {};
+                for (size_t p = 0; p < kc; p++) {
+                    // Rank-1 update of the tile by one column of A and one row of B.
+                    for (size_t i = 0; i < gemm_mr; i++) {
+                        Acc ai = a[i];
+                        for (size_t j = 0; j < gemm_nr; j++) acc[i][j] += ai * b[j];
+                    }
+                    a += gemm_mr;
+                    b += gemm_nr;
+                }
+                for (size_t i = 0; i < mr; i++)
+                    for (size_t j = 0; j < nr; j++) c[i * ldc + j] += acc[i][j];
+#endif
+            }
+
+            // The blocked product of In matrices, every multiply-add is done in Acc and C is kept in Acc.
+            template <typename In, typename Acc>
+            static void gemm_blocked(size_t m, size_t n, size_t k,
+                                     const In *a, size_t lda,
+                                     const In *b, size_t ldb,
+                                     Acc *c, size_t ldc) {
+                // Nothing to accumulate.
+                if (!m || !n || !k) return;
+                // The packing buffers, the strips and slivers are rounded up to whole register tiles.
+                size_t kc_max = min(gemm_kc, k);
+                Scratch<Acc> packed_a((min(gemm_mc, m) + gemm_mr - 1) / gemm_mr * gemm_mr * kc_max);
+                Scratch<Acc> packed_b((min(gemm_nc, n) + gemm_nr - 1) / gemm_nr * gemm_nr * kc_max);
+                // Loop over the panels of B which fit in L3.
+                for (size_t jc = 0; jc < n; jc += gemm_nc) {
+                    size_t nc = min(gemm_nc, n - jc);
+                    // Loop over the depth, every kc slice of B is packed once.
+                    for (size_t pc = 0; pc < k; pc += gemm_kc) {
+                        size_t kc = min(gemm_kc, k - pc);
+                        pack_b(kc, nc, b + pc * ldb + jc, ldb, packed_b.data());
+                        // Loop over the blocks of A which fit in L2.
+                        for (size_t ic = 0; ic < m; ic += gemm_mc) {
+                            size_t mc = min(gemm_mc, m - ic);
+                            pack_a(mc, kc, a + ic * lda + pc, lda, packed_a.data());
+                            // Sweep the register tiles over the block.
+                            for (size_t jr = 0; jr < nc; jr += gemm_nr) {
+                                for (size_t ir = 0; ir < mc; ir += gemm_mr) {
+                                    micro_kernel(kc, packed_a.data() + ir * kc, packed_b.data() + jr * kc,
+                                                 c + (ic + ir) * ldc + jc + jr, ldc,
+                                                 min(gemm_mr, mc - ir), min(gemm_nr, nc - jr));
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            template <typename T>
+            static void gemm_tiled(size_t m, size_t n, size_t k,
+                                   const T *a, size_t lda,
+                                   const T *b, size_t ldb,
+                                   T *c, size_t ldc) {
+                ThreadPool &pool = thread_pool();
+                // Threading does not pay off for small products.
+                if (pool.size() == 1 || m * n * k < gemm_parallel_threshold) {
+                    gemm_blocked(m, n, k, a, lda, b, ldb, c, ldc);
+                    return;
+                }
+                // Split C into a grid of mc*nc tiles, each tile is one task.
+                size_t row_tiles = (m + gemm_mc - 1) / gemm_mc;
+                size_t col_tiles = (n + gemm_parallel_nc - 1) / gemm_parallel_nc;
+                pool.parallel_for(row_tiles * col_tiles, [&](size_t tile) {
+                    size_t i = tile / col_tiles * gemm_mc;
+                    size_t j = tile % col_tiles * gemm_parallel_nc;
+                    gemm_blocked(min(gemm_mc, m - i), min(gemm_parallel_nc, n - j), k,
+                                 a + i * lda, lda, b + j, ldb, c + i * ldc + j, ldc);
+                });
+            }
+
+            void gemm(size_t m, size_t n, size_t k,
+                      const double *a, size_t lda,
+                      const double *b, size_t ldb,
+                      double *c, size_t ldc) {
+                gemm_blocked(m, n, k, a, lda, b, ldb, c, ldc);
+            }
+
+            void gemm(size_t m, size_t n, size_t k,
+                      const float *a, size_t lda,
+                      const float *b, size_t ldb,
+                      float *c, size_t ldc) {
+                gemm_blocked(m, n, k, a, lda, b, ldb, c, ldc);
+            }
+
+            void gemm_parallel(size_t m, size_t n, size_t k,
+                               const double *a, size_t lda,
+                               const double *b, size_t ldb,
+                               double *c, size_t ldc) {
+                gemm_tiled(m, n, k, a, lda, b, ldb, c, ldc);
+            }
+
+            void gemm_parallel(size_t m, size_t n, size_t k,
+                               const float *a, size_t lda,
+                               const float *b, size_t ldb,
+                               float *c, size_t ldc) {
+                gemm_tiled(m, n, k, a, lda, b, ldb, c, ldc);
+            }
+
+            void gemm_mixed(size_t m, size_t n, size_t k,
+                            const float *a, size_t lda,
+                            const float *b, size_t ldb,
+                            float *c, size_t ldc) {
+                if (!m || !n || !k) return;
+                // Every tile of C is accumulated over the whole depth in a double buffer, then rounded once.
+                size_t row_tiles = (m + gemm_mc - 1) / gemm_mc;
+                size_t col_tiles = (n + gemm_parallel_nc - 1) / gemm_parallel_nc;
+                auto tile_task = [&](size_t tile) {
+                    size_t i = tile / col_tiles * gemm_mc, mc = min(gemm_mc, m - i);
+                    size_t j = tile % col_tiles * gemm_parallel_nc, nc = min(gemm_parallel_nc, n - j);
+                    Scratch<double> acc(mc * nc);
+                    for (size_t r = 0; r < mc; r++)
+                        for (size_t s = 0; s < nc; s++) acc[r * nc + s] = c[(i + r) * ldc + j + s];
+                    gemm_blocked(mc, nc, k, a + i * lda, lda, b + j, ldb, acc.data(), nc);
+                    for (size_t r = 0; r < mc; r++)
+                        for (size_t s = 0; s < nc; s++) c[(i + r) * ldc + j + s] = static_cast<float>(acc[r * nc + s]);
+                };
+                ThreadPool &pool = thread_pool();
+                // Threading does not pay off for small products.
+                if (pool.size() == 1 || m * n * k < gemm_parallel_threshold) {
+                    for (size_t tile = 0; tile < row_tiles * col_tiles; tile++) tile_task(tile);
+                    return;
+                }
+                pool.parallel_for(row_tiles * col_tiles, tile_task);
+            }
+        }
+    }
+}
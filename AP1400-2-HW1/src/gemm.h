@@ -0,0 +1,63 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_GEMM_H
+#define SRC_GEMM_H
+
+#include <cstddef>
+
+// The kernels behind algebra::multiply.
+namespace algebra {
+    namespace kernel {
+        // The size of the register tile computed by the micro-kernel.
+        constexpr size_t gemm_mr = 4;
+        constexpr size_t gemm_nr = 8;
+
+        // The cache blocking of the packed panels.
+        // A mc*kc block of A stays in L2, a kc*nr sliver of B stays in L1,
+        // and a kc*nc panel of B stays in L3.
+        constexpr size_t gemm_mc = 128;
+        constexpr size_t gemm_kc = 256;
+        constexpr size_t gemm_nc = 2048;
+
+        // Perform C += A * B where A is m*k, B is k*n and C is m*n.
+        // All three are row-major with the given leading dimensions (stride of a row).
+        void gemm(size_t m, size_t n, size_t k,
+                  const double *a, size_t lda,
+                  const double *b, size_t ldb,
+                  double *c, size_t ldc);
+        void gemm(size_t m, size_t n, size_t k,
+                  const float *a, size_t lda,
+                  const float *b, size_t ldb,
+                  float *c, size_t ldc);
+
+        // The products with fewer multiply-adds than this run on one thread.
+        constexpr size_t gemm_parallel_threshold = 128 * 128 * 128;
+
+        // The width of the column tiles shared between the threads.
+        constexpr size_t gemm_parallel_nc = 256;
+
+        // Same as gemm, but the tiles of C are computed by the shared thread pool.
+        // Every element is accumulated in the same order as gemm, so the results are identical in one variant.
+        void gemm_parallel(size_t m, size_t n, size_t k,
+                           const double *a, size_t lda,
+                           const double *b, size_t ldb,
+                           double *c, size_t ldc);
+        void gemm_parallel(size_t m, size_t n, size_t k,
+                           const float *a, size_t lda,
+                           const float *b, size_t ldb,
+                           float *c, size_t ldc);
+
+        // Perform C += A * B on floats with the products and sums done in double, on the shared thread pool.
+        // The panels are converted to double while they are packed, and every element of C is rounded
+        // to float once at the end, so the error does not grow with k like a float accumulation does.
+        void gemm_mixed(size_t m, size_t n, size_t k,
+                        const float *a, size_t lda,
+                        const float *b, size_t ldb,
+                        float *c, size_t ldc);
+    }
+}
+
+#endif //SRC_GEMM_H
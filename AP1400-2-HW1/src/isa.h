@@ -0,0 +1,79 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_ISA_H
+#define SRC_ISA_H
+
+#include <cstddef>
+
+// The variants of the hot kernels, one per instruction set, see dispatch.h.
+// Every kernel source is compiled once per variant, CMake defines ALGEBRA_ISA_AVX2 or ALGEBRA_ISA_AVX512
+// for the wider ones. A kernel source includes this header last and puts its code in namespace ALGEBRA_ISA,
+// so the variants do not clash and the public kernel functions in dispatch.cpp can call each of them.
+#define ALGEBRA_KERNEL_VARIANT(isa)                                                                   \
+    namespace algebra {                                                                               \
+        namespace kernel {                                                                            \
+            namespace isa {                                                                           \
+                const char *elementwise_isa();                                                        \
+                void scale(const double *src, double c, double *dst, size_t n);                       \
+                void scale(const float *src, float c, float *dst, size_t n);                          \
+                void shift(const double *src, double c, double *dst, size_t n);                       \
+                void shift(const float *src, float c, float *dst, size_t n);                          \
+                void add(const double *a, const double *b, double *dst, size_t n);                    \
+                void add(const float *a, const float *b, float *dst, size_t n);                       \
+                void subtract(const double *a, const double *b, double *dst, size_t n);               \
+                void subtract(const float *a, const float *b, float *dst, size_t n);                  \
+                void gemm(size_t m, size_t n, size_t k, const double *a, size_t lda,                  \
+                          const double *b, size_t ldb, double *c, size_t ldc);                        \
+                void gemm(size_t m, size_t n, size_t k, const float *a, size_t lda,                   \
+                          const float *b, size_t ldb, float *c, size_t ldc);                          \
+                void gemm_parallel(size_t m, size_t n, size_t k, const double *a, size_t lda,         \
+                                   const double *b, size_t ldb, double *c, size_t ldc);               \
+                void gemm_parallel(size_t m, size_t n, size_t k, const float *a, size_t lda,          \
+                                   const float *b, size_t ldb, float *c, size_t ldc);                 \
+                void gemm_mixed(size_t m, size_t n, size_t k, const float *a, size_t lda,             \
+                                const float *b, size_t ldb, float *c, size_t ldc);                    \
+                void transpose(size_t rows, size_t cols, const double *src, size_t lds,               \
+                               double *dst, size_t ldd);                                              \
+                void transpose(size_t rows, size_t cols, const float *src, size_t lds,                \
+                               float *dst, size_t ldd);                                               \
+                void transpose_in_place(size_t n, double *a, size_t lda);                             \
+                void transpose_in_place(size_t n, float *a, size_t lda);                              \
+                int eliminate(size_t n, double *a, size_t lda, size_t *pivot);                        \
+                int eliminate(size_t n, float *a, size_t lda, size_t *pivot);                         \
+            }                                                                                         \
+        }                                                                                             \
+    }
+
+ALGEBRA_KERNEL_VARIANT(generic)
+#if defined(ALGEBRA_DISPATCH)
+ALGEBRA_KERNEL_VARIANT(avx2)
+ALGEBRA_KERNEL_VARIANT(avx512)
+#endif
+
+// The instructions of the variant are enabled by a pragma rather than a flag, so it applies only to the code
+// after this header: the inline functions of the other headers stay generic, and the linker cannot pick
+// their wide copies for the rest of the library. The pragma does not define __AVX2__ and the like in C++.
+// ALGEBRA_ISA_BYTES is the size of a vector register of the variant.
+#if defined(ALGEBRA_ISA_AVX512)
+#define ALGEBRA_ISA avx512
+#define ALGEBRA_ISA_BYTES 64
+#pragma GCC target("avx512f,avx512vl,avx512bw,avx512dq,avx2,fma,prefer-vector-width=512")
+#elif defined(ALGEBRA_ISA_AVX2)
+#define ALGEBRA_ISA avx2
+#define ALGEBRA_ISA_BYTES 32
+#pragma GCC target("avx2,fma")
+#else
+#define ALGEBRA_ISA generic
+#if defined(__AVX512F__)
+#define ALGEBRA_ISA_BYTES 64
+#elif defined(__AVX__)
+#define ALGEBRA_ISA_BYTES 32
+#else
+#define ALGEBRA_ISA_BYTES 16
+#endif
+#endif
+
+#endif //SRC_ISA_H
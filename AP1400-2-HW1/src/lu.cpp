@@ -0,0 +1,185 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include "elimination.h"
+#include "lu.h"
+#include "substitution.h"
+#include "workspace.h"
+
+using std::logic_error;
+
+namespace algebra {
+    LU::LU(const DenseMatrix& matrix) : _factors(matrix), _pivot(matrix.rows()), _sign(1), _singular(false), _norm(0) {
+        // Check if the matrix is square
+        if (matrix.rows() != matrix.cols()) throw logic_error("The matrix should be square.");
+        size_t n = matrix.rows();
+        // A pivot below this is considered as zero, relative to the largest element.
+        double largest = 0;
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = 0; j < n; j++) largest = std::max(largest, std::abs(matrix(i, j)));
+        double tolerance = largest * n * std::numeric_limits<double>::epsilon();
+        // The 1-norm is the largest column sum, kept for the condition estimate.
+        Scratch<double> column_sum(n);
+        std::fill(column_sum.data(), column_sum.data() + n, 0.0);
+        for (size_t i = 0; i < n; i++)
+            for (size_t j = 0; j < n; j++) column_sum[j] += std::abs(matrix(i, j));
+        for (size_t j = 0; j < n; j++) _norm = std::max(_norm, column_sum[j]);
+        // Eliminate by panels, then look for a negligible pivot on the diagonal of U.
+        _sign = kernel::eliminate(n, _factors.data(), _factors.stride(), _pivot.data());
+        for (size_t k = 0; k < n; k++)
+            if (std::abs(_factors(k, k)) <= tolerance) _singular = true;
+    }
+
+    size_t LU::size() const {
+        return _factors.rows();
+    }
+
+    const DenseMatrix& LU::factors() const {
+        return _factors;
+    }
+
+    std::vector<size_t> LU::pivot() const {
+        return {_pivot.begin(), _pivot.end()};
+    }
+
+    bool LU::singular() const {
+        return _singular;
+    }
+
+    DenseMatrix LU::lower() const {
+        size_t n = size();
+        DenseMatrix res(n, n);
+        for (size_t i = 0; i < n; i++) {
+            std::copy(_factors.row(i), _factors.row(i) + i, res.row(i));
+            res(i, i) = 1;
+        }
+        return res;
+    }
+
+    DenseMatrix LU::upper() const {
+        size_t n = size();
+        DenseMatrix res(n, n);
+        for (size_t i = 0; i < n; i++)
+            std::copy(_factors.row(i) + i, _factors.row(i) + n, res.row(i) + i);
+        return res;
+    }
+
+    double LU::determinant() const {
+        // The determinant is the product of the diagonal of U, signed by the permutation.
+        // A pivot is zero only if it is exactly zero or within the rounding of the elimination which produced it,
+        // that is of the terms of (|L| * |U|)(k, k) it was cancelled from. Unlike singular(), the test does not
+        // compare the pivot with the rest of the matrix, so a tiny pivot which is not made of cancellation counts.
+        size_t n = size();
+        double res = _sign, rounding = n * std::numeric_limits<double>::epsilon();
+        for (size_t k = 0; k < n; k++) {
+            double pivot = _factors(k, k), magnitude = std::abs(pivot);
+            for (size_t i = 0; i < k; i++) magnitude += std::abs(_factors(k, i) * _factors(i, k));
+            if (std::abs(pivot) <= rounding * magnitude) return 0;
+            res *= pivot;
+        }
+        return res;
+    }
+
+    DenseMatrix LU::inverse() const {
+        if (_singular) throw logic_error("Matrix is not invertible.");
+        // Solve A * X = I.
+        size_t n = size();
+        DenseMatrix res(n, n);
+        for (size_t i = 0; i < n; i++) res(i, i) = 1;
+        solve_in_place(res);
+        return res;
+    }
+
+    DenseMatrix LU::solve(const DenseMatrix& b) const {
+        // Check if the right-hand sides fit the matrix
+        if (b.rows() != size()) throw logic_error("The right-hand side should have as many rows as the matrix.");
+        if (_singular) throw logic_error("Matrix is singular.");
+        DenseMatrix res(b);
+        solve_in_place(res);
+        return res;
+    }
+
+    std::vector<double> LU::solve(const std::vector<double>& b) const {
+        DenseMatrix column(b.size(), 1);
+        for (size_t i = 0; i < b.size(); i++) column(i, 0) = b[i];
+        column = solve(column);
+        std::vector<double> res(b.size());
+        for (size_t i = 0; i < b.size(); i++) res[i] = column(i, 0);
+        return res;
+    }
+
+    double LU::rcond() const {
+        size_t n = size();
+        if (_singular || !n) return 0;
+        // Estimate |A^-1| by Hager's method: maximize |A^-1 * x| over the unit ball of the 1-norm,
+        // which needs a few solves instead of the whole inverse.
+        DenseMatrix x(n, 1, 1.0 / n);
+        double estimate = 0;
+        Scratch<double> z(n);
+        for (int iteration = 0; iteration < 5; iteration++) {
+            // y = A^-1 * x
+            DenseMatrix y(x);
+            solve_in_place(y);
+            estimate = 0;
+            for (size_t i = 0; i < n; i++) {
+                estimate += std::abs(y(i, 0));
+                z[i] = y(i, 0) >= 0 ? 1 : -1;
+            }
+            // z = A^-T * sign(y), its largest element gives the next direction.
+            solve_transposed_in_place(z.data());
+            size_t j = 0;
+            double zx = 0;
+            for (size_t i = 0; i < n; i++) {
+                if (std::abs(z[i]) > std::abs(z[j])) j = i;
+                zx += z[i] * x(i, 0);
+            }
+            // Stop when no direction can improve the estimate.
+            if (iteration && std::abs(z[j]) <= zx) break;
+            x = DenseMatrix(n, 1);
+            x(j, 0) = 1;
+        }
+        return 1 / (_norm * estimate);
+    }
+
+    void LU::solve_in_place(DenseMatrix& b) const {
+        size_t n = size(), m = b.cols();
+        // Apply the permutation: row i of P * B is row pivot[i] of B.
+        DenseMatrix permuted(n, m);
+        for (size_t i = 0; i < n; i++)
+            std::copy(b.row(_pivot[i]), b.row(_pivot[i]) + m, permuted.row(i));
+        b = std::move(permuted);
+        // Forward substitution with the unit L, then back substitution with U.
+        kernel::solve_lower(n, m, _factors.data(), _factors.stride(), true, b.data(), b.stride());
+        kernel::solve_upper(n, m, _factors.data(), _factors.stride(), b.data(), b.stride());
+    }
+
+    void LU::solve_transposed_in_place(double *b) const {
+        size_t n = size();
+        // A^T = U^T * L^T * P, solve U^T first by forward substitution.
+        for (size_t i = 0; i < n; i++) {
+            b[i] /= _factors(i, i);
+            for (size_t k = i + 1; k < n; k++) b[k] -= _factors(i, k) * b[i];
+        }
+        // Then the unit L^T by back substitution.
+        for (size_t i = n; i-- > 0;)
+            for (size_t k = 0; k < i; k++) b[k] -= _factors(i, k) * b[i];
+        // Undo the permutation.
+        Scratch<double> res(n);
+        for (size_t i = 0; i < n; i++) res[_pivot[i]] = b[i];
+        std::copy(res.data(), res.data() + n, b);
+    }
+
+    LU lu(const DenseMatrix& matrix) {
+        return LU(matrix);
+    }
+
+    LU lu(const Matrix& matrix) {
+        return LU(DenseMatrix(matrix));
+    }
+}
@@ -0,0 +1,85 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_LU_H
+#define SRC_LU_H
+
+#include <vector>
+#include "dense_matrix.h"
+#include "workspace.h"
+
+namespace algebra {
+    // The LU factorization P * A = L * U of a square matrix, computed by blocked elimination with
+    // partial pivoting in O(n^3).
+    // L is unit lower triangular and U is upper triangular, both are kept in one matrix.
+    class LU {
+    public:
+        // Factorize the given matrix.
+        // Throw logic_error if the matrix is not square.
+        explicit LU(const DenseMatrix& matrix);
+
+        // Return the number of rows of the factorized matrix.
+        size_t size() const;
+
+        // Return L below the diagonal and U on and above the diagonal.
+        const DenseMatrix& factors() const;
+
+        // Return the pivot vector: row i of P * A is row pivot()[i] of A.
+        std::vector<size_t> pivot() const;
+
+        // Return true if a pivot is negligible compared with the largest element of the matrix.
+        bool singular() const;
+
+        // Return the unit lower triangular L.
+        DenseMatrix lower() const;
+
+        // Return the upper triangular U.
+        DenseMatrix upper() const;
+
+        // Return the determinant of the factorized matrix, zero if a pivot is zero up to the rounding of the
+        // elimination. The tolerance of singular() does not apply, a matrix with tiny pivots keeps its determinant.
+        double determinant() const;
+
+        // Return the inverse of the factorized matrix.
+        // Throw logic_error if the matrix is singular.
+        DenseMatrix inverse() const;
+
+        // Return the solution X of A * X = B, B has the right-hand sides as its columns.
+        // The factors are reused, so every right-hand side costs O(n^2).
+        // Throw logic_error if B does not have size() rows or the matrix is singular.
+        DenseMatrix solve(const DenseMatrix& b) const;
+
+        // Return the solution x of A * x = b.
+        std::vector<double> solve(const std::vector<double>& b) const;
+
+        // Return an estimate of the reciprocal condition number 1 / (|A| * |A^-1|) in the 1-norm.
+        // Close to 1 for a well-conditioned matrix, close to 0 for a nearly singular one.
+        double rcond() const;
+
+    private:
+        // L and U packed in one matrix.
+        DenseMatrix _factors;
+        // The row permutation, from the buffer cache so a factorization does not call operator new.
+        BufferVector<size_t> _pivot;
+        // The parity of the permutation, 1 or -1.
+        int _sign;
+        // Set when a negligible pivot is found.
+        bool _singular;
+        // The 1-norm of the factorized matrix.
+        double _norm;
+
+        // A helper method to solve A * X = B in place, B has its columns as right-hand sides.
+        void solve_in_place(DenseMatrix& b) const;
+
+        // A helper method to solve A^T * x = b in place for one right-hand side of size() elements.
+        void solve_transposed_in_place(double *b) const;
+    };
+
+    // Return the LU factorization of the input matrix.
+    LU lu(const DenseMatrix& matrix);
+    LU lu(const Matrix& matrix);
+}
+
+#endif //SRC_LU_H
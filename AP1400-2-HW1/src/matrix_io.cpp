@@ -0,0 +1,220 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "matrix_io.h"
+
+using std::logic_error;
+using std::runtime_error;
+using std::string;
+
+namespace algebra {
+    // The current version of the format.
+    static constexpr uint32_t file_version = 1;
+
+    // A helper function to throw runtime_error with the reason of the last failed system call,
+    // or of the given error number when the call was followed by another one.
+    static void fail(const string &what, const string &path, int error = errno) {
+        throw runtime_error(what + " " + path + ": " + std::strerror(error));
+    }
+
+    void save(const string &path, const DenseMatrix &matrix) {
+        MatrixWriter writer(path, matrix.rows(), matrix.cols());
+        writer.write_rows(matrix);
+        writer.close();
+    }
+
+    void save(const string &path, const Matrix &matrix) {
+        MatrixWriter writer(path, matrix.size(), matrix.empty() ? 0 : matrix[0].size());
+        for (const auto &row : matrix) {
+            // Check if all rows have the same length.
+            if (row.size() != matrix[0].size()) throw logic_error("All rows should have the same length.");
+            writer.write_row(row.data());
+        }
+        writer.close();
+    }
+
+    // A helper function to fill the header of a rows*cols matrix file.
+    static FileHeader make_header(size_t rows, size_t cols) {
+        FileHeader header{};
+        std::memcpy(header.magic, "ALGM", 4);
+        header.version = file_version;
+        header.dtype = Dtype::float64;
+        header.alignment = DenseMatrix::alignment;
+        header.rows = rows;
+        header.cols = cols;
+        header.stride = DenseMatrix::padded_stride(cols);
+        header.offset = sizeof header;
+        return header;
+    }
+
+    // A helper function to read or write exactly bytes bytes at the given offset, retrying the short transfers.
+    template<typename Transfer, typename Pointer>
+    static bool transfer_fully(Transfer transfer, int fd, Pointer buffer, size_t bytes, off_t offset) {
+        while (bytes) {
+            ssize_t done = transfer(fd, buffer, bytes, offset);
+            if (done < 0 && errno == EINTR) continue;
+            if (done <= 0) return false;
+            buffer += done;
+            bytes -= done;
+            offset += done;
+        }
+        return true;
+    }
+
+    DenseMatrix load(const string &path) {
+        MatrixFile file(path);
+        // Nothing to map for an empty matrix.
+        if (!file.rows() || !file.cols()) return DenseMatrix(file.rows(), file.cols());
+        // Map the whole file, the header fills one cache line so the first row stays aligned.
+        size_t bytes = static_cast<size_t>(file.offset(file.rows(), 0));
+        void *base = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE, file._fd, 0);
+        if (base == MAP_FAILED) fail("Cannot map", path);
+        std::shared_ptr<double> data(reinterpret_cast<double *>(static_cast<char *>(base) + sizeof(FileHeader)),
+                                     [base, bytes](double *) { ::munmap(base, bytes); });
+        return DenseMatrix(file.rows(), file.cols(), std::move(data));
+    }
+
+    MatrixFile::MatrixFile(const string &path, bool writable)
+            : _fd(::open(path.c_str(), writable ? O_RDWR : O_RDONLY)), _header(), _path(path) {
+        if (_fd < 0) fail("Cannot open", path);
+        struct stat st;
+        if (::fstat(_fd, &st) || ::pread(_fd, &_header, sizeof _header, 0) != sizeof _header) {
+            ::close(_fd);
+            throw runtime_error("Cannot read the header of " + path);
+        }
+        // Check if the header describes a matrix this build can read, and if the file holds all of it.
+        size_t bytes = static_cast<size_t>(st.st_size);
+        bool valid = !std::memcmp(_header.magic, "ALGM", 4) && _header.version == file_version &&
+                     _header.dtype == Dtype::float64 && _header.alignment == DenseMatrix::alignment &&
+                     _header.offset == sizeof _header && _header.stride == DenseMatrix::padded_stride(_header.cols) &&
+                     (!_header.stride || _header.rows <= (bytes - sizeof _header) / (_header.stride * sizeof(double)));
+        if (!valid) {
+            ::close(_fd);
+            throw runtime_error(path + " is not a valid matrix file.");
+        }
+    }
+
+    MatrixFile::MatrixFile(int fd, const FileHeader &header, const string &path)
+            : _fd(fd), _header(header), _path(path) {}
+
+    MatrixFile MatrixFile::create(const string &path, size_t rows, size_t cols) {
+        int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) fail("Cannot create", path);
+        MatrixFile file(fd, make_header(rows, cols), path);
+        // Extending the file gives zero elements and zero padding without writing them.
+        if (!transfer_fully(::pwrite, fd, reinterpret_cast<const char *>(&file._header), sizeof file._header, 0) ||
+            ::ftruncate(fd, file.offset(rows, 0)))
+            fail("Cannot write", path);
+        return file;
+    }
+
+    MatrixFile::MatrixFile(MatrixFile &&other) noexcept
+            : _fd(other._fd), _header(other._header), _path(std::move(other._path)) {
+        other._fd = -1;
+    }
+
+    MatrixFile::~MatrixFile() {
+        if (_fd >= 0) ::close(_fd);
+    }
+
+    size_t MatrixFile::rows() const {
+        return _header.rows;
+    }
+
+    size_t MatrixFile::cols() const {
+        return _header.cols;
+    }
+
+    size_t MatrixFile::stride() const {
+        return _header.stride;
+    }
+
+    void MatrixFile::read(size_t row, size_t col, size_t rows, size_t cols, double *dst, size_t ldd) const {
+        check(row, col, rows, cols);
+        // Whole rows with the same layout are one contiguous range of the file.
+        if (cols == _header.cols && ldd == _header.stride) {
+            if (!transfer_fully(::pread, _fd, reinterpret_cast<char *>(dst),
+                                rows * ldd * sizeof(double), offset(row, 0)))
+                fail("Cannot read", _path);
+            return;
+        }
+        for (size_t i = 0; i < rows; i++)
+            if (!transfer_fully(::pread, _fd, reinterpret_cast<char *>(dst + i * ldd),
+                                cols * sizeof(double), offset(row + i, col)))
+                fail("Cannot read", _path);
+    }
+
+    void MatrixFile::write(size_t row, size_t col, size_t rows, size_t cols, const double *src, size_t lds) {
+        check(row, col, rows, cols);
+        for (size_t i = 0; i < rows; i++)
+            if (!transfer_fully(::pwrite, _fd, reinterpret_cast<const char *>(src + i * lds),
+                                cols * sizeof(double), offset(row + i, col)))
+                fail("Cannot write", _path);
+    }
+
+    off_t MatrixFile::offset(size_t row, size_t col) const {
+        return static_cast<off_t>(_header.offset + (row * _header.stride + col) * sizeof(double));
+    }
+
+    void MatrixFile::check(size_t row, size_t col, size_t rows, size_t cols) const {
+        if (row + rows > _header.rows || col + cols > _header.cols)
+            throw logic_error("The block is out of the matrix.");
+    }
+
+    MatrixWriter::MatrixWriter(const string &path, size_t rows, size_t cols)
+            : _rows(rows), _cols(cols), _stride(DenseMatrix::padded_stride(cols)), _written(0),
+              _file(std::fopen(path.c_str(), "wb")), _path(path) {
+        if (!_file) fail("Cannot create", path);
+        FileHeader header = make_header(rows, cols);
+        if (std::fwrite(&header, sizeof header, 1, _file) != 1) {
+            // The reason of the failed write, fclose may overwrite it.
+            int error = errno;
+            std::fclose(_file);
+            fail("Cannot write", path, error);
+        }
+    }
+
+    MatrixWriter::~MatrixWriter() {
+        if (_file) std::fclose(_file);
+    }
+
+    void MatrixWriter::write_row(const double *row) {
+        if (!_file || _written == _rows) throw logic_error("All the rows are already written.");
+        static const double zeros[DenseMatrix::alignment / sizeof(double)] = {};
+        if (std::fwrite(row, sizeof(double), _cols, _file) != _cols ||
+            std::fwrite(zeros, sizeof(double), _stride - _cols, _file) != _stride - _cols)
+            fail("Cannot write", _path);
+        _written++;
+    }
+
+    void MatrixWriter::write_rows(const DenseMatrix &matrix) {
+        if (matrix.cols() != _cols) throw logic_error("The matrix should have the same number of columns.");
+        if (!_file || _written + matrix.rows() > _rows) throw logic_error("All the rows are already written.");
+        // The layout in the file is the layout in memory, padding included, so write the buffer as a whole.
+        size_t count = matrix.rows() * _stride;
+        if (std::fwrite(matrix.data(), sizeof(double), count, _file) != count) fail("Cannot write", _path);
+        _written += matrix.rows();
+    }
+
+    size_t MatrixWriter::written() const {
+        return _written;
+    }
+
+    void MatrixWriter::close() {
+        if (!_file) return;
+        if (_written != _rows) throw logic_error("Not all the rows are written.");
+        int res = std::fclose(_file);
+        _file = nullptr;
+        if (res) fail("Cannot write", _path);
+    }
+}
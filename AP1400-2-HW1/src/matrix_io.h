@@ -0,0 +1,145 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_MATRIX_IO_H
+#define SRC_MATRIX_IO_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <sys/types.h>
+#include "dense_matrix.h"
+
+// The binary matrix files.
+// A file is a 64 byte header followed by the rows of the matrix exactly as a DenseMatrix keeps them,
+// stride elements per row with zero padding, so loading it is a single mmap with no copy or parse.
+namespace algebra {
+    // The element types a file can hold.
+    enum class Dtype : uint32_t {
+        float64 = 1
+    };
+
+    // The header at the beginning of every file, all fields are in the byte order of the host.
+    struct FileHeader {
+        // The magic bytes "ALGM".
+        char magic[4];
+        // The version of the format.
+        uint32_t version;
+        // The element type.
+        Dtype dtype;
+        // The alignment of the rows in bytes.
+        uint32_t alignment;
+        // The shape and the distance in elements between two rows.
+        uint64_t rows;
+        uint64_t cols;
+        uint64_t stride;
+        // The offset of the first element from the beginning of the file.
+        uint64_t offset;
+        // Reserved, always zero.
+        uint8_t reserved[16];
+    };
+
+    static_assert(sizeof(FileHeader) == DenseMatrix::alignment, "The header should fill one cache line.");
+
+    // Save the matrix to the file at path, replacing it if it exists.
+    // Throw runtime_error if the file cannot be written.
+    void save(const std::string &path, const DenseMatrix &matrix);
+    void save(const std::string &path, const Matrix &matrix);
+
+    // Map the file at path into a matrix without copying it.
+    // The mapping is private: changes of the matrix are not written back to the file.
+    // Throw runtime_error if the file cannot be read or is not a valid matrix file.
+    DenseMatrix load(const std::string &path);
+
+    // An open matrix file with random access to its elements, for matrices which do not fit in memory.
+    // Reads and writes go straight to the file and may run on several threads at the same time.
+    class MatrixFile {
+    public:
+        // Constructor that opens an existing matrix file, for reading only unless writable is true.
+        // Throw runtime_error if the file cannot be opened or is not a valid matrix file.
+        explicit MatrixFile(const std::string &path, bool writable = false);
+
+        // Create a rows*cols matrix file with all elements equal to zero, open for reading and writing.
+        // The file is sparse, so no disk space is used until the elements are written.
+        static MatrixFile create(const std::string &path, size_t rows, size_t cols);
+
+        // The matrix file owns the descriptor, it can be moved but not copied.
+        MatrixFile(MatrixFile &&other) noexcept;
+        MatrixFile(const MatrixFile &) = delete;
+        MatrixFile &operator=(const MatrixFile &) = delete;
+
+        // Destructor, closes the file.
+        ~MatrixFile();
+
+        // Return the shape of the matrix and the distance in elements between two rows.
+        size_t rows() const;
+        size_t cols() const;
+        size_t stride() const;
+
+        // Read the rows*cols block starting at (row, col) into dst, whose rows are ldd elements apart.
+        // Throw logic_error if the block is out of range, runtime_error if the read fails.
+        void read(size_t row, size_t col, size_t rows, size_t cols, double *dst, size_t ldd) const;
+
+        // Write the rows*cols block src, whose rows are lds elements apart, at (row, col).
+        // Throw logic_error if the block is out of range, runtime_error if the write fails.
+        void write(size_t row, size_t col, size_t rows, size_t cols, const double *src, size_t lds);
+
+    private:
+        int _fd;
+        FileHeader _header;
+        std::string _path;
+
+        // Constructor that takes over an open descriptor and its header.
+        MatrixFile(int fd, const FileHeader &header, const std::string &path);
+
+        // A helper method to return the offset in bytes of the element at (row, col).
+        off_t offset(size_t row, size_t col) const;
+
+        // A helper method to throw logic_error if the block is not inside the matrix.
+        void check(size_t row, size_t col, size_t rows, size_t cols) const;
+
+        friend DenseMatrix load(const std::string &path);
+    };
+
+    // A writer that streams a rows*cols matrix to a file one row at a time,
+    // for results which do not fit in memory.
+    class MatrixWriter {
+    public:
+        // Constructor that creates the file and writes the header.
+        // Throw runtime_error if the file cannot be created.
+        MatrixWriter(const std::string &path, size_t rows, size_t cols);
+
+        // The writer owns the file, it cannot be copied.
+        MatrixWriter(const MatrixWriter &) = delete;
+        MatrixWriter &operator=(const MatrixWriter &) = delete;
+
+        // Destructor, closes the file if close() was not called.
+        ~MatrixWriter();
+
+        // Append one row of cols elements.
+        // Throw logic_error if all the rows are already written.
+        void write_row(const double *row);
+
+        // Append all the rows of the matrix, it must have cols columns.
+        void write_rows(const DenseMatrix &matrix);
+
+        // Return the number of rows written so far.
+        size_t written() const;
+
+        // Flush and close the file.
+        // Throw logic_error if not all the rows are written, runtime_error if the flush fails.
+        void close();
+
+    private:
+        size_t _rows;
+        size_t _cols;
+        size_t _stride;
+        size_t _written;
+        std::FILE *_file;
+        std::string _path;
+    };
+}
+
+#endif //SRC_MATRIX_IO_H
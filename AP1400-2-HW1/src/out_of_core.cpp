@@ -0,0 +1,193 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "dense_matrix.h"
+#include "gemm.h"
+#include "matrix_io.h"
+#include "out_of_core.h"
+
+using std::logic_error;
+using std::min;
+using std::string;
+
+namespace algebra {
+    // The number of tiles held at the same time: two of A, two of B and two of the result,
+    // one of each being worked on while the other is read or written.
+    static constexpr size_t resident_tiles = 6;
+
+    namespace {
+        // The thread which reads and writes the tiles of the out-of-core products, in the order the transfers
+        // are queued. It is shared by all the calls and started on first use, so a product starts no thread.
+        class IoThread {
+        public:
+            IoThread() : _stop(false), _thread(&IoThread::run, this) {}
+
+            IoThread(const IoThread &other) = delete;
+            IoThread &operator=(const IoThread &other) = delete;
+
+            // Destructor that runs the queued transfers and joins the thread.
+            ~IoThread() {
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _stop = true;
+                }
+                _wake.notify_all();
+                _thread.join();
+            }
+
+            // Return the thread shared by the products.
+            static IoThread &shared() {
+                static IoThread thread;
+                return thread;
+            }
+
+            // Queue the transfer, the future holds its error if it throws.
+            std::future<void> submit(std::function<void()> transfer) {
+                std::packaged_task<void()> task(std::move(transfer));
+                std::future<void> res = task.get_future();
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _queue.push_back(std::move(task));
+                }
+                _wake.notify_one();
+                return res;
+            }
+
+        private:
+            std::mutex _mutex;
+            std::condition_variable _wake;
+            std::deque<std::packaged_task<void()>> _queue;
+            bool _stop;
+            std::thread _thread;
+
+            void run() {
+                std::unique_lock<std::mutex> lock(_mutex);
+                while (true) {
+                    _wake.wait(lock, [this] { return _stop || !_queue.empty(); });
+                    if (_queue.empty()) return;
+                    std::packaged_task<void()> task = std::move(_queue.front());
+                    _queue.pop_front();
+                    lock.unlock();
+                    task();
+                    lock.lock();
+                }
+            }
+        };
+
+        // A queued transfer, which is waited for when it is replaced or goes away like a future of std::async,
+        // so the tiles it reads or writes outlive it.
+        class Transfer {
+        public:
+            Transfer() = default;
+
+            explicit Transfer(std::function<void()> transfer)
+                    : _future(IoThread::shared().submit(std::move(transfer))) {}
+
+            Transfer(const Transfer &other) = delete;
+
+            Transfer &operator=(Transfer &&other) noexcept {
+                wait();
+                _future = std::move(other._future);
+                return *this;
+            }
+
+            ~Transfer() { wait(); }
+
+            bool valid() const { return _future.valid(); }
+
+            // Wait for the transfer and rethrow its error.
+            void get() { _future.get(); }
+
+        private:
+            std::future<void> _future;
+
+            void wait() {
+                if (_future.valid()) _future.wait();
+            }
+        };
+    }
+
+    // The edge of the smallest tile, one cache line of doubles so every tile row stays aligned.
+    static constexpr size_t min_tile = DenseMatrix::alignment / sizeof(double);
+
+    void multiply_out_of_core(const string &path1, const string &path2, const string &path_result,
+                              size_t memory_budget) {
+        MatrixFile a(path1), b(path2);
+        // Check if either matrix is empty, and write an empty matrix if so.
+        if (!a.rows() || !a.cols() || !b.rows() || !b.cols()) {
+            MatrixFile::create(path_result, 0, 0);
+            return;
+        }
+        // Check for compatible dimensions for matrix multiplication.
+        if (a.cols() != b.rows())
+            throw logic_error("The number of columns in the first matrix must equal "
+                              "the number of rows in the second matrix.");
+        size_t m = a.rows(), n = b.cols(), k = a.cols();
+        // The largest tile edge, a multiple of min_tile, that keeps all the resident tiles within the budget,
+        // and never larger than the matrices themselves.
+        size_t tile = static_cast<size_t>(std::sqrt(memory_budget / (resident_tiles * sizeof(double))));
+        tile = min(tile / min_tile * min_tile, DenseMatrix::padded_stride(std::max({m, n, k})));
+        if (!tile) throw logic_error("The memory budget is too small.");
+        MatrixFile c = MatrixFile::create(path_result, m, n);
+
+        // Every step multiplies the tile (i, p) of A into the tile (p, j) of B and adds it to the tile (i, j) of C.
+        // The steps of one tile of C are consecutive, so it stays in memory until it is complete.
+        struct Step {
+            size_t i, j, p;
+        };
+        std::vector<Step> steps;
+        for (size_t i = 0; i < m; i += tile)
+            for (size_t j = 0; j < n; j += tile)
+                for (size_t p = 0; p < k; p += tile)
+                    steps.push_back({i, j, p});
+
+        // The tiles are declared before the transfers, so any pending transfer finishes before they go away.
+        DenseMatrix tiles_a[2]{{tile, tile}, {tile, tile}};
+        DenseMatrix tiles_b[2]{{tile, tile}, {tile, tile}};
+        DenseMatrix tiles_c[2]{{tile, tile}, {tile, tile}};
+        auto read = [&](size_t s) {
+            const Step &step = steps[s];
+            size_t rows = min(tile, m - step.i), cols = min(tile, n - step.j), inner = min(tile, k - step.p);
+            a.read(step.i, step.p, rows, inner, tiles_a[s % 2].data(), tile);
+            b.read(step.p, step.j, inner, cols, tiles_b[s % 2].data(), tile);
+        };
+        auto write = [&](size_t s, size_t slot) {
+            const Step &step = steps[s];
+            c.write(step.i, step.j, min(tile, m - step.i), min(tile, n - step.j), tiles_c[slot].data(), tile);
+        };
+        Transfer reading([&] { read(0); });
+        Transfer writing;
+
+        size_t slot = 0;
+        for (size_t s = 0; s < steps.size(); s++) {
+            const Step &step = steps[s];
+            // Wait for the tiles of this step, then start reading the next ones into the other buffers.
+            reading.get();
+            if (s + 1 < steps.size()) reading = Transfer([&read, s] { read(s + 1); });
+            DenseMatrix &tile_c = tiles_c[slot];
+            if (!step.p) std::fill(tile_c.data(), tile_c.data() + tile * tile, 0.0);
+            size_t rows = min(tile, m - step.i), cols = min(tile, n - step.j), inner = min(tile, k - step.p);
+            kernel::gemm_parallel(rows, cols, inner, tiles_a[s % 2].data(), tile, tiles_b[s % 2].data(), tile,
+                                  tile_c.data(), tile);
+            // The tile of C is complete, write it while the next one is computed in the other buffer.
+            if (step.p + tile >= k) {
+                if (writing.valid()) writing.get();
+                writing = Transfer([&write, s, slot] { write(s, slot); });
+                slot ^= 1;
+            }
+        }
+        writing.get();
+    }
+}
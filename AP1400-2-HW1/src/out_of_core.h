@@ -0,0 +1,22 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_OUT_OF_CORE_H
+#define SRC_OUT_OF_CORE_H
+
+#include <string>
+
+namespace algebra {
+    // Multiply the matrix in the file path1 into the matrix in the file path2 and write the product
+    // to the file path_result, keeping at most about memory_budget bytes of the matrices in memory.
+    // The product is computed one square tile of the result at a time: while a pair of tiles is multiplied,
+    // the next pair is read and the previous result tile is written by one I/O thread shared by all the calls.
+    // Throw logic_error if the dimensions do not match or the budget cannot hold the smallest tiles,
+    // runtime_error if a file cannot be read or written.
+    void multiply_out_of_core(const std::string &path1, const std::string &path2, const std::string &path_result,
+                              size_t memory_budget);
+}
+
+#endif //SRC_OUT_OF_CORE_H
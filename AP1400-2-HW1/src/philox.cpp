@@ -0,0 +1,93 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+#include "philox.h"
+#include "thread_pool.h"
+
+using std::logic_error;
+
+namespace algebra {
+    // The multipliers and the key increments of Philox4x32.
+    static constexpr uint32_t philox_m0 = 0xD2511F53;
+    static constexpr uint32_t philox_m1 = 0xCD9E8D57;
+    static constexpr uint32_t philox_w0 = 0x9E3779B9;
+    static constexpr uint32_t philox_w1 = 0xBB67AE85;
+
+    // The number of elements a task of the parallel fill works on.
+    static constexpr size_t random_chunk = 1 << 16;
+
+    Philox::Philox(uint64_t seed) : _key0(static_cast<uint32_t>(seed)), _key1(static_cast<uint32_t>(seed >> 32)) {}
+
+    std::array<uint32_t, 4> Philox::operator()(uint64_t counter) const {
+        uint32_t c0 = static_cast<uint32_t>(counter), c1 = static_cast<uint32_t>(counter >> 32), c2 = 0, c3 = 0;
+        uint32_t k0 = _key0, k1 = _key1;
+        // Ten rounds of multiply, xor and key bump.
+        for (int round = 0; round < 10; round++) {
+            uint64_t p0 = static_cast<uint64_t>(philox_m0) * c0;
+            uint64_t p1 = static_cast<uint64_t>(philox_m1) * c2;
+            uint32_t n0 = static_cast<uint32_t>(p1 >> 32) ^ c1 ^ k0;
+            uint32_t n2 = static_cast<uint32_t>(p0 >> 32) ^ c3 ^ k1;
+            c1 = static_cast<uint32_t>(p1);
+            c3 = static_cast<uint32_t>(p0);
+            c0 = n0;
+            c2 = n2;
+            k0 += philox_w0;
+            k1 += philox_w1;
+        }
+        return {c0, c1, c2, c3};
+    }
+
+    // Map two 32-bit words to a double in [0, 1) with 53 random bits.
+    static double to_unit(uint32_t high, uint32_t low) {
+        uint64_t bits = (static_cast<uint64_t>(high) << 32 | low) >> 11;
+        return bits * (1.0 / 9007199254740992.0);
+    }
+
+    // Compute the pair of elements 2 * counter and 2 * counter + 1 of the stream.
+    static std::array<double, 2> draw(const Philox& philox, uint64_t counter,
+                                      Distribution distribution, double a, double b) {
+        std::array<uint32_t, 4> words = philox(counter);
+        double u1 = to_unit(words[0], words[1]), u2 = to_unit(words[2], words[3]);
+        if (distribution == Distribution::uniform)
+            return {a + u1 * (b - a), a + u2 * (b - a)};
+        // Box-Muller turns two uniforms into two independent normals, 1 - u1 is in (0, 1].
+        const double two_pi = 6.283185307179586;
+        double r = std::sqrt(-2 * std::log(1 - u1));
+        return {a + b * r * std::cos(two_pi * u2), a + b * r * std::sin(two_pi * u2)};
+    }
+
+    template <typename T>
+    void random(BasicDenseMatrix<T>& matrix, Distribution distribution, double a, double b, uint64_t seed) {
+        if (distribution == Distribution::uniform && a > b) throw logic_error("min should be less than max");
+        if (distribution == Distribution::normal && b < 0)
+            throw logic_error("The standard deviation should not be negative.");
+        Philox philox(seed);
+        size_t cols = matrix.cols(), total = matrix.rows() * cols;
+        // Every task fills a range of the stream, the ranges start at even positions.
+        size_t chunks = (total + random_chunk - 1) / random_chunk;
+        thread_pool().parallel_for(chunks, [&](size_t chunk) {
+            size_t first = chunk * random_chunk, last = std::min(total, first + random_chunk);
+            for (size_t k = first; k < last; k += 2) {
+                std::array<double, 2> pair = draw(philox, k / 2, distribution, a, b);
+                matrix(k / cols, k % cols) = static_cast<T>(pair[0]);
+                if (k + 1 < last) matrix((k + 1) / cols, (k + 1) % cols) = static_cast<T>(pair[1]);
+            }
+        });
+    }
+
+    template void random(DenseMatrixF& matrix, Distribution distribution, double a, double b, uint64_t seed);
+    template void random(DenseMatrix& matrix, Distribution distribution, double a, double b, uint64_t seed);
+
+    uint64_t next_seed() {
+        // A clock based base, then a different stream for every call.
+        static const uint64_t base = std::chrono::system_clock::now().time_since_epoch().count();
+        static std::atomic<uint64_t> sequence(0);
+        return base + 0x9E3779B97F4A7C15ull * ++sequence;
+    }
+}
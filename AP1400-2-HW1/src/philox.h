@@ -0,0 +1,50 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_PHILOX_H
+#define SRC_PHILOX_H
+
+#include <array>
+#include <cstdint>
+#include "dense_matrix.h"
+
+namespace algebra {
+    // The counter-based generator Philox4x32-10.
+    // The output is a pure function of the key and the counter, so any element of the stream
+    // can be computed directly, in any order and on any thread.
+    class Philox {
+    public:
+        // Constructor that takes the seed as the key.
+        explicit Philox(uint64_t seed);
+
+        // Return the four 32-bit random words at the given position of the stream.
+        std::array<uint32_t, 4> operator()(uint64_t counter) const;
+
+    private:
+        // The two 32-bit halves of the key.
+        uint32_t _key0;
+        uint32_t _key1;
+    };
+
+    // The distributions a random matrix can follow.
+    enum class Distribution {
+        // Uniform in [a, b).
+        uniform,
+        // Normal with mean a and standard deviation b.
+        normal
+    };
+
+    // Fill the matrix from the stream of the given seed, in parallel on the thread pool.
+    // Element (i, j) only depends on the seed and on i * cols + j, so the result is the same
+    // for any number of threads.
+    // The elements are drawn in double, a float matrix gets them rounded.
+    template <typename T>
+    void random(BasicDenseMatrix<T>& matrix, Distribution distribution, double a, double b, uint64_t seed);
+
+    // Return a new seed, different on every call, for the unseeded random functions.
+    uint64_t next_seed();
+}
+
+#endif //SRC_PHILOX_H
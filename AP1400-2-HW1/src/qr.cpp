@@ -0,0 +1,341 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include "gemm.h"
+#include "qr.h"
+#include "substitution.h"
+#include "thread_pool.h"
+#include "transpose.h"
+#include "workspace.h"
+
+using std::logic_error;
+using std::min;
+
+namespace algebra {
+    // The number of columns whose reflections are gathered in one compact WY block.
+    static constexpr size_t qr_block = 64;
+
+    // The panels are split by halves down to this number of columns, which are reflected one by one.
+    static constexpr size_t qr_leaf = 8;
+
+    // The right-hand sides narrower than this are reflected by a pass over the rows instead of the blocked product.
+    static constexpr size_t qr_narrow = 8;
+
+    // The number of rows handled by one task of the pass.
+    static constexpr size_t qr_chunk = 2048;
+
+    // W = A^T * B where A is m*k and B is m*cols, by one pass over the rows. Each task sums a chunk of rows
+    // four at a time, the sums of the chunks are added in order so the result does not depend on the threads.
+    static void multiply_transposed(size_t m, size_t k, const double *a, size_t lda, size_t cols, const double *b,
+                                    size_t ldb, double *w) {
+        size_t chunks = (m + qr_chunk - 1) / qr_chunk, size = k * cols;
+        Scratch<double> partial(chunks * size);
+        thread_pool().parallel_for(chunks, [&](size_t chunk) {
+            double *sum = partial.data() + chunk * size;
+            std::fill(sum, sum + size, 0.0);
+            size_t i = chunk * qr_chunk, last = min(m, i + qr_chunk);
+            for (; i + 4 <= last; i += 4) {
+                const double *a0 = a + i * lda, *a1 = a0 + lda, *a2 = a1 + lda, *a3 = a2 + lda;
+                const double *b0 = b + i * ldb, *b1 = b0 + ldb, *b2 = b1 + ldb, *b3 = b2 + ldb;
+                for (size_t p = 0; p < k; p++) {
+                    double *row = sum + p * cols;
+                    for (size_t j = 0; j < cols; j++) row[j] += a0[p] * b0[j] + a1[p] * b1[j] + a2[p] * b2[j] + a3[p] * b3[j];
+                }
+            }
+            for (; i < last; i++)
+                for (size_t p = 0; p < k; p++)
+                    for (size_t j = 0; j < cols; j++) sum[p * cols + j] += a[i * lda + p] * b[i * ldb + j];
+        });
+        std::fill(w, w + size, 0.0);
+        for (size_t chunk = 0; chunk < chunks; chunk++)
+            for (size_t j = 0; j < size; j++) w[j] += partial[chunk * size + j];
+    }
+
+    // Copy the m*k unit lower trapezoidal V, stored below the diagonal of a, transposed into the k*m vt.
+    static void transpose_reflectors(size_t m, size_t k, const double *v, size_t ldv, double *vt) {
+        for (size_t i = 0; i < k; i++)
+            for (size_t j = 0; j < k; j++) vt[j * m + i] = j < i ? v[i * ldv + j] : j == i;
+        kernel::transpose(m - k, k, v + k * ldv, ldv, vt + k, m);
+    }
+
+    // C = (I - V * T^T * V^T) * C if transposed, else C = (I - V * T * V^T) * C, where C is m*cols,
+    // V the m*k reflectors stored below the diagonal of v and T the k*k upper triangular factor.
+    static void reflect(size_t m, size_t k, const double *v, size_t ldv, const double *t, size_t ldt,
+                        bool transposed, size_t cols, double *c, size_t ldc) {
+        if (!cols) return;
+        // W = V^T * C, by the blocked product on the transpose of V unless C is narrow.
+        Scratch<double> w(k * cols);
+        if (cols <= qr_narrow) {
+            multiply_transposed(m - k, k, v + k * ldv, ldv, cols, c + k * ldc, ldc, w.data());
+            for (size_t i = 0; i < k; i++)
+                for (size_t s = 0; s <= i; s++) {
+                    double scale = s == i ? 1 : v[i * ldv + s];
+                    for (size_t j = 0; j < cols; j++) w[s * cols + j] += scale * c[i * ldc + j];
+                }
+        } else {
+            Scratch<double> vt(k * m);
+            transpose_reflectors(m, k, v, ldv, vt.data());
+            std::fill(w.data(), w.data() + k * cols, 0.0);
+            kernel::gemm_parallel(k, cols, m, vt.data(), m, c, ldc, w.data(), cols);
+        }
+        // W = -T^T * W or -T * W, in place from the end which is not read again.
+        if (transposed) {
+            for (size_t i = k; i-- > 0;) {
+                double *row = w.data() + i * cols;
+                for (size_t j = 0; j < cols; j++) row[j] *= -t[i * ldt + i];
+                for (size_t s = 0; s < i; s++) {
+                    double scale = -t[s * ldt + i];
+                    const double *other = w.data() + s * cols;
+                    for (size_t j = 0; j < cols; j++) row[j] += scale * other[j];
+                }
+            }
+        } else {
+            for (size_t i = 0; i < k; i++) {
+                double *row = w.data() + i * cols;
+                for (size_t j = 0; j < cols; j++) row[j] *= -t[i * ldt + i];
+                for (size_t s = i + 1; s < k; s++) {
+                    double scale = -t[i * ldt + s];
+                    const double *other = w.data() + s * cols;
+                    for (size_t j = 0; j < cols; j++) row[j] += scale * other[j];
+                }
+            }
+        }
+        // C += V * W, the unit triangle on top of V by rows, the rest by the blocked product.
+        for (size_t i = 0; i < k; i++) {
+            double *row = c + i * ldc;
+            for (size_t s = 0; s <= i; s++) {
+                double scale = s == i ? 1 : v[i * ldv + s];
+                const double *other = w.data() + s * cols;
+                for (size_t j = 0; j < cols; j++) row[j] += scale * other[j];
+            }
+        }
+        kernel::gemm_parallel(m - k, cols, k, v + k * ldv, ldv, w.data(), cols, c + k * ldc, ldc);
+    }
+
+    // Factorize the m*w panel one column at a time, with m >= w, and build its w*w factor T.
+    // Every column takes one pass over the rows, which scales its vector, updates the columns on its right
+    // and already takes the norm and the dot products of the next column.
+    static void factorize_columns(size_t m, size_t w, double *a, size_t lda, double *t, size_t ldt) {
+        // sigma is the squared norm of the current column below the diagonal and raw its dot products
+        // with the other columns, both before the scaling of the vector.
+        Scratch<double> raw(w), dots(w);
+        std::fill(raw.data(), raw.data() + w, 0.0);
+        double sigma = 0;
+        for (size_t i = 1; i < m; i++) {
+            const double *row = a + i * lda;
+            sigma += row[0] * row[0];
+            for (size_t c = 1; c < w; c++) raw[c] += row[c] * row[0];
+        }
+        for (size_t j = 0; j < w; j++) {
+            double *top = a + j * lda;
+            // H = I - tau * v * v^T with v[0] = 1 maps the column on beta * e1, beta has the sign
+            // opposite to the first element so there is no cancellation. Nothing to do if the column is zero.
+            double tau = 0, scale = 1;
+            if (sigma != 0) {
+                double beta = -std::copysign(std::sqrt(top[j] * top[j] + sigma), top[j]);
+                tau = (beta - top[j]) / beta;
+                scale = 1 / (top[j] - beta);
+                top[j] = beta;
+            }
+            // dots = v^T * A, the columns on the left hold the previous vectors.
+            for (size_t c = 0; c < w; c++) dots[c] = top[c] + scale * raw[c];
+            // The column j of T is -tau * T * V^T * v on top of tau.
+            t[j * ldt + j] = tau;
+            for (size_t r = 0; r < j; r++) {
+                double value = 0;
+                for (size_t s = r; s < j; s++) value += t[r * ldt + s] * dots[s];
+                t[r * ldt + j] = -tau * value;
+            }
+            // A -= tau * v * dots on the columns on the right, then the next column is measured.
+            for (size_t c = j + 1; c < w; c++) top[c] -= tau * dots[c];
+            size_t next = j + 1;
+            std::fill(raw.data(), raw.data() + w, 0.0);
+            sigma = 0;
+            for (size_t i = j + 1; i < m; i++) {
+                double *row = a + i * lda;
+                double vi = row[j] *= scale, f = tau * vi;
+                for (size_t c = next; c < w; c++) row[c] -= f * dots[c];
+                if (i == next || next == w) continue;
+                double x = row[next];
+                sigma += x * x;
+                for (size_t c = 0; c < next; c++) raw[c] += row[c] * x;
+                for (size_t c = next + 1; c < w; c++) raw[c] += row[c] * x;
+            }
+        }
+    }
+
+    // Factorize the m*w panel by halves: the left half, its reflections applied to the right half, the right half,
+    // then T = [T1, -T1 * V1^T * V2 * T2; 0, T2].
+    static void factorize_panel(size_t m, size_t w, double *a, size_t lda, double *t, size_t ldt) {
+        if (w <= qr_leaf) {
+            // The leaf runs on a contiguous copy, so its passes stream the rows instead of striding over them.
+            Scratch<double> leaf(m * w);
+            for (size_t i = 0; i < m; i++) std::copy(a + i * lda, a + i * lda + w, leaf.data() + i * w);
+            factorize_columns(m, w, leaf.data(), w, t, ldt);
+            for (size_t i = 0; i < m; i++) std::copy(leaf.data() + i * w, leaf.data() + (i + 1) * w, a + i * lda);
+            return;
+        }
+        size_t n1 = w / 2, n2 = w - n1;
+        factorize_panel(m, n1, a, lda, t, ldt);
+        reflect(m, n1, a, lda, t, ldt, true, n2, a + n1, lda);
+        double *a22 = a + n1 * lda + n1, *t22 = t + n1 * ldt + n1;
+        factorize_panel(m - n1, n2, a22, lda, t22, ldt);
+        // X = V1^T * V2 over the rows of V2, its unit triangle is added by rows.
+        Scratch<double> x(n1 * n2);
+        multiply_transposed(m - w, n1, a + w * lda, lda, n2, a22 + n2 * lda, lda, x.data());
+        for (size_t r = 0; r < n2; r++)
+            for (size_t s = 0; s <= r; s++) {
+                double value = s == r ? 1 : a22[r * lda + s];
+                for (size_t p = 0; p < n1; p++) x[p * n2 + s] += a[(n1 + r) * lda + p] * value;
+            }
+        // X = X * T2, in place from the last column.
+        for (size_t p = 0; p < n1; p++) {
+            double *row = x.data() + p * n2;
+            for (size_t b = n2; b-- > 0;) {
+                double value = 0;
+                for (size_t s = 0; s <= b; s++) value += row[s] * t22[s * ldt + b];
+                row[b] = value;
+            }
+        }
+        // T12 = -T1 * X
+        for (size_t p = 0; p < n1; p++)
+            for (size_t b = 0; b < n2; b++) {
+                double value = 0;
+                for (size_t s = p; s < n1; s++) value += t[p * ldt + s] * x[s * n2 + b];
+                t[p * ldt + n1 + b] = -value;
+            }
+    }
+
+    QR::QR(const DenseMatrix& matrix)
+            : _factors(matrix), _t(min(qr_block, matrix.cols()), matrix.cols()), _rank_deficient(false) {
+        // Check if the matrix is tall
+        if (matrix.rows() < matrix.cols()) throw logic_error("The matrix should have at least as many rows as columns.");
+        size_t m = matrix.rows(), n = matrix.cols(), lda = _factors.stride();
+        double *a = _factors.data();
+        // A diagonal element of R below this is considered as zero, relative to the largest element.
+        double largest = 0;
+        for (size_t i = 0; i < m; i++)
+            for (size_t j = 0; j < n; j++) largest = std::max(largest, std::abs(matrix(i, j)));
+        double tolerance = largest * m * std::numeric_limits<double>::epsilon();
+        // Right-looking by blocks: factorize a panel, apply its reflections to the columns on its right.
+        for (size_t k0 = 0; k0 < n; k0 += qr_block) {
+            size_t w = min(qr_block, n - k0);
+            double *panel = a + k0 * lda + k0;
+            factorize_panel(m - k0, w, panel, lda, _t.data() + k0, _t.stride());
+            if (k0 + w == n) break;
+            reflect(m - k0, w, panel, lda, _t.data() + k0, _t.stride(), true, n - k0 - w, panel + w, lda);
+        }
+        for (size_t k = 0; k < n; k++)
+            if (std::abs(_factors(k, k)) <= tolerance) _rank_deficient = true;
+    }
+
+    size_t QR::rows() const {
+        return _factors.rows();
+    }
+
+    size_t QR::cols() const {
+        return _factors.cols();
+    }
+
+    const DenseMatrix& QR::factors() const {
+        return _factors;
+    }
+
+    bool QR::rank_deficient() const {
+        return _rank_deficient;
+    }
+
+    DenseMatrix QR::q() const {
+        DenseMatrix res(rows(), cols());
+        for (size_t i = 0; i < cols(); i++) res(i, i) = 1;
+        apply_in_place(res, false);
+        return res;
+    }
+
+    DenseMatrix QR::r() const {
+        size_t n = cols();
+        DenseMatrix res(n, n);
+        for (size_t i = 0; i < n; i++)
+            std::copy(_factors.row(i) + i, _factors.row(i) + n, res.row(i) + i);
+        return res;
+    }
+
+    DenseMatrix QR::apply_q(const DenseMatrix& c) const {
+        // Check if C fits Q
+        if (c.rows() != rows()) throw logic_error("The matrix should have as many rows as Q.");
+        DenseMatrix res(c);
+        apply_in_place(res, false);
+        return res;
+    }
+
+    DenseMatrix QR::apply_qt(const DenseMatrix& c) const {
+        // Check if C fits Q
+        if (c.rows() != rows()) throw logic_error("The matrix should have as many rows as Q.");
+        DenseMatrix res(c);
+        apply_in_place(res, true);
+        return res;
+    }
+
+    DenseMatrix QR::solve(const DenseMatrix& b) const {
+        // Check if the right-hand sides fit the matrix
+        if (b.rows() != rows()) throw logic_error("The right-hand side should have as many rows as the matrix.");
+        if (_rank_deficient) throw logic_error("The matrix should have full column rank.");
+        // R * X = the first n rows of Q^T * B, the other rows are the residual.
+        DenseMatrix qtb(b);
+        apply_in_place(qtb, true);
+        size_t n = cols();
+        DenseMatrix res(n, b.cols());
+        for (size_t i = 0; i < n; i++) std::copy(qtb.row(i), qtb.row(i) + b.cols(), res.row(i));
+        kernel::solve_upper(n, res.cols(), _factors.data(), _factors.stride(), res.data(), res.stride());
+        return res;
+    }
+
+    std::vector<double> QR::solve(const std::vector<double>& b) const {
+        DenseMatrix column(b.size(), 1);
+        for (size_t i = 0; i < b.size(); i++) column(i, 0) = b[i];
+        column = solve(column);
+        std::vector<double> res(column.rows());
+        for (size_t i = 0; i < res.size(); i++) res[i] = column(i, 0);
+        return res;
+    }
+
+    DenseMatrix QR::solve_transposed(const DenseMatrix& b) const {
+        // Check if the right-hand sides fit the transposed matrix
+        if (b.rows() != cols()) throw logic_error("The right-hand side should have as many rows as the matrix has columns.");
+        if (_rank_deficient) throw logic_error("The matrix should have full column rank.");
+        // A^T = R^T * Q^T, so X = Q * [Y; 0] with R^T * Y = B is the solution orthogonal to the null space.
+        size_t n = cols();
+        DenseMatrix lower(n, n), res(rows(), b.cols());
+        kernel::transpose(n, n, _factors.data(), _factors.stride(), lower.data(), lower.stride());
+        for (size_t i = 0; i < n; i++) std::copy(b.row(i), b.row(i) + b.cols(), res.row(i));
+        kernel::solve_lower(n, res.cols(), lower.data(), lower.stride(), false, res.data(), res.stride());
+        apply_in_place(res, false);
+        return res;
+    }
+
+    void QR::apply_in_place(DenseMatrix& c, bool transposed) const {
+        size_t m = rows(), n = cols(), lda = _factors.stride();
+        const double *a = _factors.data();
+        // Q = H_0 * H_1 * ..., so Q^T * C applies the blocks from the first one and Q * C from the last one.
+        size_t blocks = (n + qr_block - 1) / qr_block;
+        for (size_t b = 0; b < blocks; b++) {
+            size_t k0 = (transposed ? b : blocks - 1 - b) * qr_block, w = min(qr_block, n - k0);
+            const double *panel = a + k0 * lda + k0;
+            reflect(m - k0, w, panel, lda, _t.data() + k0, _t.stride(), transposed, c.cols(), c.row(k0), c.stride());
+        }
+    }
+
+    QR qr(const DenseMatrix& matrix) {
+        return QR(matrix);
+    }
+
+    QR qr(const Matrix& matrix) {
+        return QR(DenseMatrix(matrix));
+    }
+}
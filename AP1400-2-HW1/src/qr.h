@@ -0,0 +1,73 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_QR_H
+#define SRC_QR_H
+
+#include <vector>
+#include "dense_matrix.h"
+
+namespace algebra {
+    // The QR factorization A = Q * R of a m*n matrix with m >= n, by Householder reflections in O(m * n^2).
+    // Q is orthogonal and R upper triangular. The reflections of each block of columns are kept in the compact
+    // WY form I - V * T * V^T, so most of the work is done by the blocked product, and the panels are split
+    // by halves down to a few columns so tall-skinny matrices also run on it.
+    class QR {
+    public:
+        // Factorize the given matrix.
+        // Throw logic_error if the matrix has more columns than rows.
+        explicit QR(const DenseMatrix& matrix);
+
+        // Return the shape of the factorized matrix.
+        size_t rows() const;
+        size_t cols() const;
+
+        // Return R on and above the diagonal and the Householder vectors below it.
+        const DenseMatrix& factors() const;
+
+        // Return true if a diagonal element of R is negligible compared with the largest element of the matrix,
+        // that is if the columns of the matrix are not independent.
+        bool rank_deficient() const;
+
+        // Return the thin Q, the m*n matrix of orthonormal columns.
+        DenseMatrix q() const;
+
+        // Return the n*n upper triangular R.
+        DenseMatrix r() const;
+
+        // Return Q * C and Q^T * C, C has rows() rows.
+        // Throw logic_error if C does not have rows() rows.
+        DenseMatrix apply_q(const DenseMatrix& c) const;
+        DenseMatrix apply_qt(const DenseMatrix& c) const;
+
+        // Return the least-squares solution X which minimizes |A * X - B|, B has the right-hand sides as its columns.
+        // Throw logic_error if B does not have rows() rows or the matrix is rank deficient.
+        DenseMatrix solve(const DenseMatrix& b) const;
+
+        // Return the least-squares solution x which minimizes |A * x - b|.
+        std::vector<double> solve(const std::vector<double>& b) const;
+
+        // Return the solution X of A^T * X = B with the smallest norm, B has cols() rows.
+        // Throw logic_error if B does not have cols() rows or the matrix is rank deficient.
+        DenseMatrix solve_transposed(const DenseMatrix& b) const;
+
+    private:
+        // R and the Householder vectors packed in one matrix.
+        DenseMatrix _factors;
+        // The triangular factors T of the blocks of columns side by side, block k is in its own columns.
+        DenseMatrix _t;
+        // Whether the columns are dependent.
+        bool _rank_deficient;
+
+        // A helper method to apply the blocks of reflections to C in place, Q^T * C if transposed, else Q * C.
+        void apply_in_place(DenseMatrix& c, bool transposed) const;
+    };
+
+    // Return the QR factorization of the input matrix.
+    QR qr(const DenseMatrix& matrix);
+    QR qr(const Matrix& matrix);
+}
+
+#endif //SRC_QR_H
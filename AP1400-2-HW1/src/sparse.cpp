@@ -0,0 +1,343 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include "sparse.h"
+#include "thread_pool.h"
+
+using std::logic_error;
+using std::min;
+using std::vector;
+
+namespace algebra {
+    // The number of rows handled by one task of the parallel products.
+    static constexpr size_t sparse_chunk = 64;
+
+    // The current threshold of the automatic selection.
+    static std::atomic<double> threshold(sparse_threshold);
+
+    // A helper function to run func(first, last) on the chunks of count rows in parallel.
+    template <typename Func>
+    static void for_each_chunk(size_t count, Func func) {
+        thread_pool().parallel_for((count + sparse_chunk - 1) / sparse_chunk, [&](size_t chunk) {
+            size_t first = chunk * sparse_chunk;
+            func(first, min(count, first + sparse_chunk));
+        });
+    }
+
+    SparseMatrix::SparseMatrix() : SparseMatrix(0, 0) {}
+
+    SparseMatrix::SparseMatrix(size_t rows, size_t cols, Format format)
+            : _rows(rows), _cols(cols), _format(format), _offsets(major() + 1, 0) {}
+
+    SparseMatrix::SparseMatrix(size_t rows, size_t cols, const vector<Triplet> &triplets, Format format)
+            : SparseMatrix(rows, cols, format) {
+        bool csr = format == Format::csr;
+        // Count the elements of every line, then place them by a counting sort.
+        for (const Triplet &t : triplets) {
+            if (t.row >= rows || t.col >= cols) throw logic_error("The element is out of range.");
+            _offsets[(csr ? t.row : t.col) + 1]++;
+        }
+        for (size_t i = 0; i < major(); i++) _offsets[i + 1] += _offsets[i];
+        vector<size_t> next(_offsets.begin(), _offsets.end() - 1);
+        vector<size_t> indices(triplets.size());
+        vector<double> values(triplets.size());
+        for (const Triplet &t : triplets) {
+            size_t k = next[csr ? t.row : t.col]++;
+            indices[k] = csr ? t.col : t.row;
+            values[k] = t.value;
+        }
+        // Sort every line, add the duplicates and drop the zeros.
+        vector<size_t> order;
+        size_t begin = 0;
+        for (size_t i = 0; i < major(); i++) {
+            size_t end = _offsets[i + 1];
+            order.resize(end - begin);
+            for (size_t k = 0; k < order.size(); k++) order[k] = begin + k;
+            std::sort(order.begin(), order.end(), [&](size_t x, size_t y) { return indices[x] < indices[y]; });
+            for (size_t k = 0; k < order.size();) {
+                size_t index = indices[order[k]];
+                double value = 0;
+                for (; k < order.size() && indices[order[k]] == index; k++) value += values[order[k]];
+                if (value == 0) continue;
+                _indices.push_back(index);
+                _values.push_back(value);
+            }
+            begin = end;
+            _offsets[i + 1] = _indices.size();
+        }
+    }
+
+    SparseMatrix::SparseMatrix(const DenseMatrix &matrix, Format format)
+            : SparseMatrix(matrix.rows(), matrix.cols(), format) {
+        bool csr = format == Format::csr;
+        for (size_t i = 0; i < major(); i++) {
+            for (size_t j = 0; j < (csr ? _cols : _rows); j++) {
+                double value = csr ? matrix(i, j) : matrix(j, i);
+                if (value == 0) continue;
+                _indices.push_back(j);
+                _values.push_back(value);
+            }
+            _offsets[i + 1] = _indices.size();
+        }
+    }
+
+    size_t SparseMatrix::rows() const {
+        return _rows;
+    }
+
+    size_t SparseMatrix::cols() const {
+        return _cols;
+    }
+
+    SparseMatrix::Format SparseMatrix::format() const {
+        return _format;
+    }
+
+    size_t SparseMatrix::nonzeros() const {
+        return _values.size();
+    }
+
+    double SparseMatrix::density() const {
+        return _rows && _cols ? static_cast<double>(nonzeros()) / (_rows * _cols) : 0;
+    }
+
+    const vector<size_t> &SparseMatrix::offsets() const {
+        return _offsets;
+    }
+
+    const vector<size_t> &SparseMatrix::indices() const {
+        return _indices;
+    }
+
+    const vector<double> &SparseMatrix::values() const {
+        return _values;
+    }
+
+    double SparseMatrix::operator()(size_t r, size_t c) const {
+        size_t line = _format == Format::csr ? r : c, index = _format == Format::csr ? c : r;
+        auto first = _indices.begin() + _offsets[line], last = _indices.begin() + _offsets[line + 1];
+        auto it = std::lower_bound(first, last, index);
+        return it != last && *it == index ? _values[it - _indices.begin()] : 0;
+    }
+
+    SparseMatrix SparseMatrix::to_format(Format format) const {
+        if (format == _format) return *this;
+        // The other layout is the transpose of the compressed arrays, built by a counting sort
+        // which keeps the indices of every new line in increasing order.
+        SparseMatrix res(_rows, _cols, format);
+        size_t minor = format == Format::csr ? _rows : _cols;
+        for (size_t index : _indices) res._offsets[index + 1]++;
+        for (size_t i = 0; i < minor; i++) res._offsets[i + 1] += res._offsets[i];
+        res._indices.resize(nonzeros());
+        res._values.resize(nonzeros());
+        vector<size_t> next(res._offsets.begin(), res._offsets.end() - 1);
+        for (size_t i = 0; i < major(); i++) {
+            for (size_t k = _offsets[i]; k < _offsets[i + 1]; k++) {
+                size_t to = next[_indices[k]]++;
+                res._indices[to] = i;
+                res._values[to] = _values[k];
+            }
+        }
+        return res;
+    }
+
+    DenseMatrix SparseMatrix::to_dense() const {
+        DenseMatrix res(_rows, _cols);
+        for (size_t i = 0; i < major(); i++)
+            for (size_t k = _offsets[i]; k < _offsets[i + 1]; k++) {
+                if (_format == Format::csr) res(i, _indices[k]) = _values[k];
+                else res(_indices[k], i) = _values[k];
+            }
+        return res;
+    }
+
+    size_t SparseMatrix::major() const {
+        return _format == Format::csr ? _rows : _cols;
+    }
+
+    vector<double> multiply(const SparseMatrix &matrix, const vector<double> &x) {
+        if (x.size() != matrix.cols()) throw logic_error("The size of the vector must equal the number of columns.");
+        const vector<size_t> &offsets = matrix.offsets(), &indices = matrix.indices();
+        const vector<double> &values = matrix.values();
+        vector<double> res(matrix.rows());
+        if (matrix.format() == SparseMatrix::Format::csc) {
+            // Scatter every column scaled by its element of x.
+            for (size_t j = 0; j < matrix.cols(); j++)
+                for (size_t k = offsets[j]; k < offsets[j + 1]; k++) res[indices[k]] += values[k] * x[j];
+            return res;
+        }
+        // Every row is the dot product of its nonzeros with x, so the rows are independent.
+        for_each_chunk(matrix.rows(), [&](size_t first, size_t last) {
+            for (size_t i = first; i < last; i++) {
+                double acc = 0;
+                for (size_t k = offsets[i]; k < offsets[i + 1]; k++) acc += values[k] * x[indices[k]];
+                res[i] = acc;
+            }
+        });
+        return res;
+    }
+
+    DenseMatrix multiply(const SparseMatrix &matrix1, const DenseMatrix &matrix2) {
+        // Check for compatible dimensions for matrix multiplication.
+        if (matrix1.cols() != matrix2.rows())
+            throw logic_error("The number of columns in the first matrix must equal "
+                              "the number of rows in the second matrix.");
+        SparseMatrix csr = matrix1.to_format(SparseMatrix::Format::csr);
+        const vector<size_t> &offsets = csr.offsets(), &indices = csr.indices();
+        const vector<double> &values = csr.values();
+        DenseMatrix res(matrix1.rows(), matrix2.cols());
+        size_t n = matrix2.cols();
+        // Row i of the result adds the rows of matrix2 picked by the nonzeros of row i, scaled by them.
+        for_each_chunk(matrix1.rows(), [&](size_t first, size_t last) {
+            for (size_t i = first; i < last; i++) {
+                double *dst = res.row(i);
+                for (size_t k = offsets[i]; k < offsets[i + 1]; k++) {
+                    const double *src = matrix2.row(indices[k]);
+                    double value = values[k];
+                    for (size_t j = 0; j < n; j++) dst[j] += value * src[j];
+                }
+            }
+        });
+        return res;
+    }
+
+    DenseMatrix multiply(const DenseMatrix &matrix1, const SparseMatrix &matrix2) {
+        // Check for compatible dimensions for matrix multiplication.
+        if (matrix1.cols() != matrix2.rows())
+            throw logic_error("The number of columns in the first matrix must equal "
+                              "the number of rows in the second matrix.");
+        const vector<size_t> &offsets = matrix2.offsets(), &indices = matrix2.indices();
+        const vector<double> &values = matrix2.values();
+        bool csr = matrix2.format() == SparseMatrix::Format::csr;
+        DenseMatrix res(matrix1.rows(), matrix2.cols());
+        for_each_chunk(matrix1.rows(), [&](size_t first, size_t last) {
+            for (size_t i = first; i < last; i++) {
+                const double *src = matrix1.row(i);
+                double *dst = res.row(i);
+                if (csr) {
+                    // Add the rows of matrix2 scaled by the elements of row i of matrix1.
+                    for (size_t p = 0; p < matrix1.cols(); p++) {
+                        double a = src[p];
+                        if (a == 0) continue;
+                        for (size_t k = offsets[p]; k < offsets[p + 1]; k++) dst[indices[k]] += a * values[k];
+                    }
+                } else {
+                    // Every element is the dot product of row i of matrix1 with the nonzeros of a column.
+                    for (size_t j = 0; j < matrix2.cols(); j++) {
+                        double acc = 0;
+                        for (size_t k = offsets[j]; k < offsets[j + 1]; k++) acc += src[indices[k]] * values[k];
+                        dst[j] = acc;
+                    }
+                }
+            }
+        });
+        return res;
+    }
+
+    SparseMatrix multiply(const SparseMatrix &matrix1, const SparseMatrix &matrix2) {
+        // Check for compatible dimensions for matrix multiplication.
+        if (matrix1.cols() != matrix2.rows())
+            throw logic_error("The number of columns in the first matrix must equal "
+                              "the number of rows in the second matrix.");
+        SparseMatrix a = matrix1.to_format(SparseMatrix::Format::csr);
+        SparseMatrix b = matrix2.to_format(SparseMatrix::Format::csr);
+        size_t rows = a.rows(), cols = b.cols();
+        // Every chunk of rows gathers its nonzeros in its own arrays, they are joined at the end.
+        size_t chunks = (rows + sparse_chunk - 1) / sparse_chunk;
+        vector<vector<size_t>> chunk_offsets(chunks), chunk_indices(chunks);
+        vector<vector<double>> chunk_values(chunks);
+        for_each_chunk(rows, [&](size_t first, size_t last) {
+            size_t chunk = first / sparse_chunk;
+            // A dense accumulator for one row, and the list of its touched columns.
+            vector<double> acc(cols, 0.0);
+            vector<char> touched(cols, 0);
+            vector<size_t> columns;
+            for (size_t i = first; i < last; i++) {
+                for (size_t k = a._offsets[i]; k < a._offsets[i + 1]; k++) {
+                    size_t p = a._indices[k];
+                    double value = a._values[k];
+                    for (size_t q = b._offsets[p]; q < b._offsets[p + 1]; q++) {
+                        size_t j = b._indices[q];
+                        if (!touched[j]) {
+                            touched[j] = 1;
+                            columns.push_back(j);
+                        }
+                        acc[j] += value * b._values[q];
+                    }
+                }
+                std::sort(columns.begin(), columns.end());
+                for (size_t j : columns) {
+                    if (acc[j] != 0) {
+                        chunk_indices[chunk].push_back(j);
+                        chunk_values[chunk].push_back(acc[j]);
+                    }
+                    acc[j] = 0;
+                    touched[j] = 0;
+                }
+                columns.clear();
+                chunk_offsets[chunk].push_back(chunk_indices[chunk].size());
+            }
+        });
+        SparseMatrix res(rows, cols);
+        for (size_t chunk = 0, i = 0; chunk < chunks; chunk++) {
+            size_t base = res._indices.size();
+            for (size_t end : chunk_offsets[chunk]) res._offsets[++i] = base + end;
+            res._indices.insert(res._indices.end(), chunk_indices[chunk].begin(), chunk_indices[chunk].end());
+            res._values.insert(res._values.end(), chunk_values[chunk].begin(), chunk_values[chunk].end());
+        }
+        return res;
+    }
+
+    DenseMatrix sum(const SparseMatrix &matrix1, const DenseMatrix &matrix2) {
+        // Check if both matrices have same dimensions.
+        if (matrix1.rows() != matrix2.rows() || matrix1.cols() != matrix2.cols())
+            throw logic_error("Both matrices must have the same dimensions.");
+        // Copy the dense matrix, then add the nonzeros into their places.
+        DenseMatrix res(matrix2);
+        bool csr = matrix1.format() == SparseMatrix::Format::csr;
+        const vector<size_t> &offsets = matrix1.offsets(), &indices = matrix1.indices();
+        const vector<double> &values = matrix1.values();
+        for (size_t i = 0; i + 1 < offsets.size(); i++)
+            for (size_t k = offsets[i]; k < offsets[i + 1]; k++) {
+                if (csr) res(i, indices[k]) += values[k];
+                else res(indices[k], i) += values[k];
+            }
+        return res;
+    }
+
+    DenseMatrix sum(const DenseMatrix &matrix1, const SparseMatrix &matrix2) {
+        return sum(matrix2, matrix1);
+    }
+
+    SparseMatrix transpose(const SparseMatrix &matrix) {
+        SparseMatrix res(matrix);
+        std::swap(res._rows, res._cols);
+        res._format = matrix._format == SparseMatrix::Format::csr ? SparseMatrix::Format::csc
+                                                                   : SparseMatrix::Format::csr;
+        return res;
+    }
+
+    void set_sparse_threshold(double value) {
+        threshold = value;
+    }
+
+    double get_sparse_threshold() {
+        return threshold;
+    }
+
+    bool prefer_sparse(const DenseMatrix &matrix) {
+        size_t limit = static_cast<size_t>(threshold * matrix.rows() * matrix.cols()), count = 0;
+        if (!limit) return false;
+        for (size_t i = 0; i < matrix.rows(); i++) {
+            const double *row = matrix.row(i);
+            for (size_t j = 0; j < matrix.cols(); j++) count += row[j] != 0;
+            if (count >= limit) return false;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,122 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_SPARSE_H
+#define SRC_SPARSE_H
+
+#include <vector>
+#include "dense_matrix.h"
+
+namespace algebra {
+    // A sparse matrix which keeps only its nonzero elements, in compressed rows (CSR) or compressed columns (CSC).
+    // In CSR the nonzeros of row i are at [offsets()[i], offsets()[i + 1]) of indices() and values(),
+    // indices() holding their columns in increasing order. CSC is the same with the roles of rows and columns
+    // exchanged, so the CSC form of a matrix is the CSR form of its transpose.
+    class SparseMatrix {
+    public:
+        // The layout of the nonzeros.
+        enum class Format {
+            csr,
+            csc
+        };
+
+        // A nonzero given by its position, for building a matrix.
+        struct Triplet {
+            size_t row;
+            size_t col;
+            double value;
+        };
+
+        // Default constructor that will create an empty 0*0 matrix.
+        SparseMatrix();
+
+        // Constructor that creates a rows*cols matrix with all elements equal to zero.
+        SparseMatrix(size_t rows, size_t cols, Format format = Format::csr);
+
+        // Constructor that takes the nonzeros in any order, the values at the same position are added.
+        // Throw logic_error if a position is out of range.
+        SparseMatrix(size_t rows, size_t cols, const std::vector<Triplet> &triplets, Format format = Format::csr);
+
+        // Convert from a dense matrix, keeping the elements which are not zero.
+        explicit SparseMatrix(const DenseMatrix &matrix, Format format = Format::csr);
+
+        // Return the shape.
+        size_t rows() const;
+        size_t cols() const;
+
+        // Return the layout.
+        Format format() const;
+
+        // Return the number of stored elements, and that number over rows * cols.
+        size_t nonzeros() const;
+        double density() const;
+
+        // Return the compressed arrays.
+        const std::vector<size_t> &offsets() const;
+        const std::vector<size_t> &indices() const;
+        const std::vector<double> &values() const;
+
+        // Return the element at rth row and cth column, found by binary search.
+        double operator()(size_t r, size_t c) const;
+
+        // Return the same matrix in the given layout, it costs O(nonzeros) when the layout changes.
+        SparseMatrix to_format(Format format) const;
+
+        // Convert to a dense matrix.
+        DenseMatrix to_dense() const;
+
+    private:
+        size_t _rows;
+        size_t _cols;
+        Format _format;
+        std::vector<size_t> _offsets;
+        std::vector<size_t> _indices;
+        std::vector<double> _values;
+
+        // A helper method to return the number of compressed lines, rows in CSR and columns in CSC.
+        size_t major() const;
+
+        friend SparseMatrix transpose(const SparseMatrix &matrix);
+        friend SparseMatrix multiply(const SparseMatrix &matrix1, const SparseMatrix &matrix2);
+    };
+
+    // Return the product of the sparse matrix and the vector x.
+    // Throw logic_error if the size of x is not the number of columns.
+    std::vector<double> multiply(const SparseMatrix &matrix, const std::vector<double> &x);
+
+    // Return a new matrix that multiplies the given matrix1 into given matrix2, one of them being sparse.
+    // Throw logic_error if the dimensions do not match.
+    DenseMatrix multiply(const SparseMatrix &matrix1, const DenseMatrix &matrix2);
+    DenseMatrix multiply(const DenseMatrix &matrix1, const SparseMatrix &matrix2);
+
+    // Return the sparse product of 2 sparse matrices, in CSR.
+    SparseMatrix multiply(const SparseMatrix &matrix1, const SparseMatrix &matrix2);
+
+    // Return a new matrix that adds a sparse and a dense matrix.
+    // Throw logic_error if the shapes are different.
+    DenseMatrix sum(const SparseMatrix &matrix1, const DenseMatrix &matrix2);
+    DenseMatrix sum(const DenseMatrix &matrix1, const SparseMatrix &matrix2);
+
+    // Return the transpose, the compressed arrays are copied as they are and only the layout is exchanged.
+    SparseMatrix transpose(const SparseMatrix &matrix);
+
+    // The dense products whose left operand has a density below the threshold run as sparse products.
+    // The default is sparse_threshold, 0 turns the automatic selection off. The sparse product of a 512*512
+    // matrix breaks even with the blocked kernel at about 45% density, the default leaves a margin for
+    // wider SIMD on the dense side.
+    constexpr double sparse_threshold = 0.25;
+
+    // Products with fewer multiply-adds than this are never checked.
+    constexpr size_t sparse_min_work = 64 * 64 * 64;
+
+    void set_sparse_threshold(double threshold);
+    double get_sparse_threshold();
+
+    // Return true if the density of the matrix is below the sparse threshold.
+    // It stops counting as soon as the answer is known.
+    bool prefer_sparse(const DenseMatrix &matrix);
+}
+
+#endif //SRC_SPARSE_H
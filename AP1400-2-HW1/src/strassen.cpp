@@ -0,0 +1,129 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include "elementwise.h"
+#include "gemm.h"
+#include "strassen.h"
+#include "thread_pool.h"
+#include "workspace.h"
+
+using std::logic_error;
+using std::min;
+
+namespace algebra {
+    // The number of rows handled by one task of the parallel additions.
+    static constexpr size_t strassen_chunk = 64;
+
+    // The current threshold of the automatic selection.
+    static std::atomic<size_t> threshold(strassen_threshold);
+
+    // The additions of the quadrants, D = A + B and D = A - B on rows*cols blocks with their own strides.
+    template <typename T>
+    static void add_blocks(size_t rows, size_t cols, const T *a, size_t lda, const T *b, size_t ldb,
+                           T *d, size_t ldd) {
+        thread_pool().parallel_for((rows + strassen_chunk - 1) / strassen_chunk, [&](size_t chunk) {
+            for (size_t i = chunk * strassen_chunk; i < min(rows, (chunk + 1) * strassen_chunk); i++)
+                kernel::add(a + i * lda, b + i * ldb, d + i * ldd, cols);
+        });
+    }
+
+    template <typename T>
+    static void subtract_blocks(size_t rows, size_t cols, const T *a, size_t lda, const T *b, size_t ldb,
+                                T *d, size_t ldd) {
+        thread_pool().parallel_for((rows + strassen_chunk - 1) / strassen_chunk, [&](size_t chunk) {
+            for (size_t i = chunk * strassen_chunk; i < min(rows, (chunk + 1) * strassen_chunk); i++)
+                kernel::subtract(a + i * lda, b + i * ldb, d + i * ldd, cols);
+        });
+    }
+
+    // C = A * B by the blocked kernel, C is overwritten.
+    template <typename T>
+    static void classical(size_t m, size_t n, size_t k, const T *a, size_t lda, const T *b, size_t ldb,
+                          T *c, size_t ldc) {
+        for (size_t i = 0; i < m; i++) std::fill(c + i * ldc, c + i * ldc + n, T(0));
+        kernel::gemm_parallel(m, n, k, a, lda, b, ldb, c, ldc);
+    }
+
+    // C = A * B where A is m*k, B is k*n and C is m*n, C is overwritten.
+    template <typename T>
+    static void strassen(size_t m, size_t n, size_t k, const T *a, size_t lda, const T *b, size_t ldb,
+                         T *c, size_t ldc) {
+        if (min(m, min(n, k)) <= strassen_crossover) {
+            classical(m, n, k, a, lda, b, ldb, c, ldc);
+            return;
+        }
+        // The even part is split into quadrants, the odd row and column are peeled off.
+        size_t m2 = m / 2, n2 = n / 2, k2 = k / 2;
+        const T *a11 = a, *a12 = a + k2, *a21 = a + m2 * lda, *a22 = a21 + k2;
+        const T *b11 = b, *b12 = b + n2, *b21 = b + k2 * ldb, *b22 = b21 + n2;
+        T *c11 = c, *c12 = c + n2, *c21 = c + m2 * ldc, *c22 = c21 + n2;
+        // The Winograd schedule of Douglas et al. needs only three temporaries, the other
+        // intermediate results are kept in the quadrants of C.
+        // They come from the workspace, every row starting on a cache line.
+        size_t ldx = BasicDenseMatrix<T>::padded_stride(k2), ldy = BasicDenseMatrix<T>::padded_stride(n2);
+        size_t ldz = ldy;
+        Scratch<T> x(m2 * ldx), y(k2 * ldy), z(m2 * ldz);
+        subtract_blocks(m2, k2, a11, lda, a21, lda, x.data(), ldx);                   // S3 = A11 - A21
+        subtract_blocks(k2, n2, b22, ldb, b12, ldb, y.data(), ldy);                   // T3 = B22 - B12
+        strassen(m2, n2, k2, x.data(), ldx, y.data(), ldy, c21, ldc);                 // P7 = S3 * T3
+        add_blocks(m2, k2, a21, lda, a22, lda, x.data(), ldx);                        // S1 = A21 + A22
+        subtract_blocks(k2, n2, b12, ldb, b11, ldb, y.data(), ldy);                   // T1 = B12 - B11
+        strassen(m2, n2, k2, x.data(), ldx, y.data(), ldy, c22, ldc);                 // P5 = S1 * T1
+        subtract_blocks(m2, k2, x.data(), ldx, a11, lda, x.data(), ldx);              // S2 = S1 - A11
+        subtract_blocks(k2, n2, b22, ldb, y.data(), ldy, y.data(), ldy);              // T2 = B22 - T1
+        strassen(m2, n2, k2, x.data(), ldx, y.data(), ldy, c12, ldc);                 // P6 = S2 * T2
+        subtract_blocks(m2, k2, a12, lda, x.data(), ldx, x.data(), ldx);              // S4 = A12 - S2
+        strassen(m2, n2, k2, x.data(), ldx, b22, ldb, c11, ldc);                      // P3 = S4 * B22
+        strassen(m2, n2, k2, a11, lda, b11, ldb, z.data(), ldz);                      // P1 = A11 * B11
+        add_blocks(m2, n2, z.data(), ldz, c12, ldc, c12, ldc);                        // U2 = P1 + P6
+        add_blocks(m2, n2, c12, ldc, c21, ldc, c21, ldc);                             // U3 = U2 + P7
+        add_blocks(m2, n2, c12, ldc, c22, ldc, c12, ldc);                             // U4 = U2 + P5
+        add_blocks(m2, n2, c21, ldc, c22, ldc, c22, ldc);                             // U7 = U3 + P5
+        add_blocks(m2, n2, c12, ldc, c11, ldc, c12, ldc);                             // U5 = U4 + P3
+        subtract_blocks(k2, n2, y.data(), ldy, b21, ldb, y.data(), ldy);              // T4 = T2 - B21
+        strassen(m2, n2, k2, a22, lda, y.data(), ldy, c11, ldc);                      // P4 = A22 * T4
+        subtract_blocks(m2, n2, c21, ldc, c11, ldc, c21, ldc);                        // U6 = U3 - P4
+        strassen(m2, n2, k2, a12, lda, b21, ldb, c11, ldc);                           // P2 = A12 * B21
+        add_blocks(m2, n2, z.data(), ldz, c11, ldc, c11, ldc);                        // U1 = P1 + P2
+        // The last column of A and row of B add a rank one update to the even part.
+        if (k % 2) kernel::gemm_parallel(2 * m2, 2 * n2, 1, a + 2 * k2, lda, b + 2 * k2 * ldb, ldb, c, ldc);
+        // The last column and the last row of C are thin products over the whole inner dimension.
+        if (n % 2) classical(2 * m2, 1, k, a, lda, b + 2 * n2, ldb, c + 2 * n2, ldc);
+        if (m % 2) classical(1, n, k, a + 2 * m2 * lda, lda, b, ldb, c + 2 * m2 * ldc, ldc);
+    }
+
+    template <typename T>
+    BasicDenseMatrix<T> multiply_strassen(const BasicDenseMatrix<T>& matrix1, const BasicDenseMatrix<T>& matrix2) {
+        // Check if either matrix is empty, and return an empty matrix if so.
+        if (matrix1.empty() || matrix2.empty()) return {};
+        // Check for compatible dimensions for matrix multiplication.
+        if (matrix1.cols() != matrix2.rows())
+            throw logic_error("The number of columns in the first matrix must equal "
+                              "the number of rows in the second matrix.");
+        BasicDenseMatrix<T> res(matrix1.rows(), matrix2.cols());
+        strassen(matrix1.rows(), matrix2.cols(), matrix1.cols(), matrix1.data(), matrix1.stride(),
+                 matrix2.data(), matrix2.stride(), res.data(), res.stride());
+        return res;
+    }
+
+    template DenseMatrixF multiply_strassen(const DenseMatrixF& matrix1, const DenseMatrixF& matrix2);
+    template DenseMatrix multiply_strassen(const DenseMatrix& matrix1, const DenseMatrix& matrix2);
+
+    void set_strassen_threshold(size_t value) {
+        threshold = value;
+    }
+
+    size_t get_strassen_threshold() {
+        return threshold;
+    }
+
+    bool prefer_strassen(size_t m, size_t n, size_t k) {
+        size_t limit = threshold;
+        return limit && min(m, min(n, k)) >= limit;
+    }
+}
@@ -0,0 +1,35 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_STRASSEN_H
+#define SRC_STRASSEN_H
+
+#include "dense_matrix.h"
+
+namespace algebra {
+    // Return a new matrix that multiplies the given matrix1 into given matrix2 by the Strassen-Winograd
+    // recursion: 7 half size products and 15 additions per level instead of 8 products.
+    // The recursion stops at strassen_crossover, below it the blocked kernel is faster.
+    // Any shape is accepted, an odd dimension is peeled off and its row or column is computed by the
+    // blocked kernel. The error bound grows by about a factor of 12 per level compared to the classical product.
+    // Throw logic_error if the dimensions do not match.
+    template <typename T>
+    BasicDenseMatrix<T> multiply_strassen(const BasicDenseMatrix<T>& matrix1, const BasicDenseMatrix<T>& matrix2);
+
+    // The recursion splits a product as long as its smallest dimension is above the crossover.
+    constexpr size_t strassen_crossover = 512;
+
+    // The dense products whose smallest dimension reaches the threshold run by multiply_strassen.
+    // The default is strassen_threshold, 0 turns the automatic selection off.
+    constexpr size_t strassen_threshold = 2048;
+
+    void set_strassen_threshold(size_t threshold);
+    size_t get_strassen_threshold();
+
+    // Return true if a m*k by k*n product should run by multiply_strassen.
+    bool prefer_strassen(size_t m, size_t n, size_t k);
+}
+
+#endif //SRC_STRASSEN_H
@@ -0,0 +1,77 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#include <algorithm>
+#include "gemm.h"
+#include "substitution.h"
+#include "thread_pool.h"
+#include "workspace.h"
+
+using std::min;
+
+namespace algebra {
+    namespace kernel {
+        // The width of the column ranges of B shared between the threads.
+        static constexpr size_t substitution_nc = 256;
+
+        // B[i0, i1) -= T[i0, i1) * X[k0, k1) where T is the triangular matrix and X the solved rows of B.
+        // The kernel only adds, so the negated piece of T is copied out.
+        static void subtract_solved(size_t i0, size_t i1, size_t k0, size_t k1, size_t m, const double *t, size_t ldt,
+                                    double *b, size_t ldb) {
+            size_t rows = i1 - i0, width = k1 - k0;
+            if (!width) return;
+            Scratch<double> scratch(rows * width);
+            for (size_t i = 0; i < rows; i++)
+                for (size_t k = 0; k < width; k++) scratch[i * width + k] = -t[(i0 + i) * ldt + k0 + k];
+            gemm_parallel(rows, m, width, scratch.data(), width, b + k0 * ldb, ldb, b + i0 * ldb, ldb);
+        }
+
+        void solve_lower(size_t n, size_t m, const double *l, size_t ldl, bool unit, double *b, size_t ldb) {
+            for (size_t i0 = 0; i0 < n; i0 += substitution_block) {
+                size_t i1 = min(n, i0 + substitution_block);
+                subtract_solved(i0, i1, 0, i0, m, l, ldl, b, ldb);
+                // The triangle on the diagonal, row by row so the inner loop runs along B.
+                thread_pool().parallel_for((m + substitution_nc - 1) / substitution_nc, [&](size_t chunk) {
+                    size_t first = chunk * substitution_nc, last = min(m, first + substitution_nc);
+                    for (size_t i = i0; i < i1; i++) {
+                        double *row_i = b + i * ldb;
+                        for (size_t k = i0; k < i; k++) {
+                            double value = l[i * ldl + k];
+                            if (value == 0) continue;
+                            const double *row_k = b + k * ldb;
+                            for (size_t j = first; j < last; j++) row_i[j] -= value * row_k[j];
+                        }
+                        if (unit) continue;
+                        double diagonal = l[i * ldl + i];
+                        for (size_t j = first; j < last; j++) row_i[j] /= diagonal;
+                    }
+                });
+            }
+        }
+
+        void solve_upper(size_t n, size_t m, const double *u, size_t ldu, double *b, size_t ldb) {
+            // The blocks from the bottom, the last one may be shorter.
+            for (size_t i1 = n; i1 > 0;) {
+                size_t i0 = i1 > substitution_block ? i1 - substitution_block : 0;
+                subtract_solved(i0, i1, i1, n, m, u, ldu, b, ldb);
+                thread_pool().parallel_for((m + substitution_nc - 1) / substitution_nc, [&](size_t chunk) {
+                    size_t first = chunk * substitution_nc, last = min(m, first + substitution_nc);
+                    for (size_t i = i1; i-- > i0;) {
+                        double *row_i = b + i * ldb;
+                        for (size_t k = i + 1; k < i1; k++) {
+                            double value = u[i * ldu + k];
+                            if (value == 0) continue;
+                            const double *row_k = b + k * ldb;
+                            for (size_t j = first; j < last; j++) row_i[j] -= value * row_k[j];
+                        }
+                        double diagonal = u[i * ldu + i];
+                        for (size_t j = first; j < last; j++) row_i[j] /= diagonal;
+                    }
+                });
+                i1 = i0;
+            }
+        }
+    }
+}
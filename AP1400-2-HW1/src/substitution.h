@@ -0,0 +1,29 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_SUBSTITUTION_H
+#define SRC_SUBSTITUTION_H
+
+#include <cstddef>
+
+// The triangular solves behind algebra::solve, algebra::LU and algebra::Cholesky.
+namespace algebra {
+    namespace kernel {
+        // The number of rows solved before the rest of the right-hand sides is updated by one product.
+        constexpr size_t substitution_block = 64;
+
+        // Solve L * X = B in place by forward substitution, L is n*n lower triangular and B is n*m.
+        // Only the elements on and below the diagonal of L are read, the diagonal is taken as 1 if unit is set.
+        // Every block of rows first subtracts the solved rows above it by the blocked product, then the
+        // small triangle is solved with the columns of B shared between the threads.
+        void solve_lower(size_t n, size_t m, const double *l, size_t ldl, bool unit, double *b, size_t ldb);
+
+        // Solve U * X = B in place by back substitution, U is n*n upper triangular and B is n*m.
+        // Only the elements on and above the diagonal of U are read.
+        void solve_upper(size_t n, size_t m, const double *u, size_t ldu, double *b, size_t ldb);
+    }
+}
+
+#endif //SRC_SUBSTITUTION_H
@@ -0,0 +1,163 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include "qr.h"
+#include "svd.h"
+#include "thread_pool.h"
+#include "transpose.h"
+#include "workspace.h"
+
+using std::logic_error;
+
+namespace algebra {
+    // The rotations give up after this number of sweeps over all the pairs, the usual count is below 10.
+    static constexpr size_t svd_sweeps = 60;
+
+    // A matrix this many times longer than wide is reduced by QR before the rotations.
+    static constexpr size_t svd_reduction = 2;
+
+    // Make the rows i and j of G orthogonal, along with the same rotation of the rows of V^T.
+    // squares holds the squared norms of the rows of G, they are updated without another pass.
+    // Return true if a rotation was needed, that is if the cosine of their angle is above tolerance.
+    static bool rotate(size_t p, size_t q, double *g, size_t ldg, double *vt, size_t ldv, double *squares,
+                       size_t i, size_t j, double tolerance) {
+        double *gi = g + i * ldg, *gj = g + j * ldg;
+        double alpha = squares[i], beta = squares[j], gamma = 0;
+        for (size_t r = 0; r < p; r++) gamma += gi[r] * gj[r];
+        if (gamma == 0 || std::abs(gamma) <= tolerance * std::sqrt(alpha) * std::sqrt(beta)) return false;
+        // The rotation which diagonalizes the 2*2 Gram matrix [alpha gamma; gamma beta], the smaller angle.
+        double zeta = (beta - alpha) / (2 * gamma);
+        double t = std::copysign(1.0, zeta) / (std::abs(zeta) + std::sqrt(1 + zeta * zeta));
+        double c = 1 / std::sqrt(1 + t * t), s = c * t;
+        for (size_t r = 0; r < p; r++) {
+            double first = gi[r], second = gj[r];
+            gi[r] = c * first - s * second;
+            gj[r] = s * first + c * second;
+        }
+        double *vi = vt + i * ldv, *vj = vt + j * ldv;
+        for (size_t r = 0; r < q; r++) {
+            double first = vi[r], second = vj[r];
+            vi[r] = c * first - s * second;
+            vj[r] = s * first + c * second;
+        }
+        squares[i] = alpha - t * gamma;
+        squares[j] = beta + t * gamma;
+        return true;
+    }
+
+    // A helper function to set squares to the squared norms of the q rows of G.
+    static void row_squares(size_t p, size_t q, const double *g, size_t ldg, double *squares) {
+        thread_pool().parallel_for(q, [&](size_t i) {
+            const double *row = g + i * ldg;
+            double sum = 0;
+            for (size_t r = 0; r < p; r++) sum += row[r] * row[r];
+            squares[i] = sum;
+        });
+    }
+
+    SVD::SVD(const DenseMatrix& matrix) {
+        size_t m = matrix.rows(), n = matrix.cols();
+        if (!m || !n) return;
+        // The method runs on B = A, or B = A^T when A is wide, so B is p*q with p >= q.
+        // The columns of B are kept as the rows of G = B^T, so a rotation runs along contiguous rows.
+        bool wide = m < n;
+        size_t p = wide ? n : m, q = wide ? m : n;
+        if (p >= svd_reduction * q) {
+            // A long B = Q * R is reduced to its q*q R first: R = U_R * S * V^T gives B = (Q * U_R) * S * V^T.
+            // The rotations then run on q rows instead of p.
+            DenseMatrix b = wide ? DenseMatrix(p, q) : matrix;
+            if (wide) kernel::transpose(m, n, matrix.data(), matrix.stride(), b.data(), b.stride());
+            QR factorization(b);
+            SVD reduced(factorization.r());
+            DenseMatrix left(p, q);
+            for (size_t i = 0; i < q; i++) std::copy(reduced._u.row(i), reduced._u.row(i) + q, left.row(i));
+            left = factorization.apply_q(left);
+            _values = std::move(reduced._values);
+            _u = wide ? std::move(reduced._v) : std::move(left);
+            _v = wide ? std::move(left) : std::move(reduced._v);
+            return;
+        }
+        DenseMatrix g = wide ? matrix : DenseMatrix(q, p), vt(q, q);
+        if (!wide) kernel::transpose(m, n, matrix.data(), matrix.stride(), g.data(), g.stride());
+        for (size_t i = 0; i < q; i++) vt(i, i) = 1;
+        // The dot products of long columns are off by about sqrt(p) roundings.
+        double tolerance = std::sqrt(double(p)) * std::numeric_limits<double>::epsilon();
+        // Round-robin order: player 0 stays, the others turn by one place each round, so every pair meets
+        // once per sweep and the q/2 pairs of a round are disjoint. An odd q gets a dummy player.
+        size_t players = q + q % 2;
+        Scratch<size_t> seat(players);
+        Scratch<double> squares(q);
+        std::iota(seat.data(), seat.data() + players, 0);
+        for (size_t sweep = 0;; sweep++) {
+            if (sweep == svd_sweeps) throw logic_error("The singular values did not converge.");
+            // The updated norms drift by a few roundings per rotation, they are measured again every sweep.
+            row_squares(p, q, g.data(), g.stride(), squares.data());
+            std::atomic<bool> rotated(false);
+            for (size_t round = 0; round + 1 < players; round++) {
+                thread_pool().parallel_for(players / 2, [&](size_t pair) {
+                    size_t i = seat[pair], j = seat[players - 1 - pair];
+                    if (i >= q || j >= q) return;
+                    if (rotate(p, q, g.data(), g.stride(), vt.data(), vt.stride(), squares.data(),
+                               std::min(i, j), std::max(i, j), tolerance))
+                        rotated = true;
+                });
+                std::rotate(seat.data() + 1, seat.data() + players - 1, seat.data() + players);
+            }
+            if (!rotated) break;
+        }
+        // The singular values are the norms of the columns of B, its normalized columns are the vectors of U.
+        Scratch<double> norm(q);
+        row_squares(p, q, g.data(), g.stride(), norm.data());
+        for (size_t i = 0; i < q; i++) norm[i] = std::sqrt(norm[i]);
+        std::vector<size_t> order(q);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](size_t i, size_t j) { return norm[i] > norm[j]; });
+        _values.resize(q);
+        DenseMatrix left(p, q), right(q, q);
+        for (size_t c = 0; c < q; c++) {
+            size_t i = order[c];
+            _values[c] = norm[i];
+            double scale = norm[i] > 0 ? 1 / norm[i] : 0;
+            const double *column = g.row(i), *vector = vt.row(i);
+            for (size_t r = 0; r < p; r++) left(r, c) = column[r] * scale;
+            for (size_t r = 0; r < q; r++) right(r, c) = vector[r];
+        }
+        // A = B^T = V_B * S * U_B^T when A is wide.
+        _u = std::move(wide ? right : left);
+        _v = std::move(wide ? left : right);
+    }
+
+    const std::vector<double>& SVD::values() const {
+        return _values;
+    }
+
+    const DenseMatrix& SVD::u() const {
+        return _u;
+    }
+
+    const DenseMatrix& SVD::v() const {
+        return _v;
+    }
+
+    size_t SVD::rank(double tolerance) const {
+        if (_values.empty()) return 0;
+        return std::count_if(_values.begin(), _values.end(),
+                             [&](double value) { return value > tolerance * _values.front(); });
+    }
+
+    SVD svd(const DenseMatrix& matrix) {
+        return SVD(matrix);
+    }
+
+    SVD svd(const Matrix& matrix) {
+        return SVD(DenseMatrix(matrix));
+    }
+}
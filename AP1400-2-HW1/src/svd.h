@@ -0,0 +1,47 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_SVD_H
+#define SRC_SVD_H
+
+#include <vector>
+#include "dense_matrix.h"
+
+namespace algebra {
+    // The thin singular value decomposition A = U * diag(values) * V^T of a m*n matrix, with k = min(m, n)
+    // singular values, computed by the one-sided Jacobi method. Pairs of columns are rotated until all are
+    // orthogonal, which gives the small singular values to high relative accuracy. The disjoint pairs of
+    // a round are rotated in parallel. A tall-skinny matrix is reduced to the R of its QR first.
+    class SVD {
+    public:
+        // Decompose the given matrix.
+        // Throw logic_error if the rotations do not converge.
+        explicit SVD(const DenseMatrix& matrix);
+
+        // Return the singular values in descending order.
+        const std::vector<double>& values() const;
+
+        // Return the m*k matrix of the left singular vectors, column i belongs to values()[i].
+        // The column of a zero singular value is zero.
+        const DenseMatrix& u() const;
+
+        // Return the n*k matrix of the right singular vectors, column i belongs to values()[i].
+        const DenseMatrix& v() const;
+
+        // Return the number of singular values above tolerance times the largest one.
+        size_t rank(double tolerance = 1e-12) const;
+
+    private:
+        std::vector<double> _values;
+        DenseMatrix _u;
+        DenseMatrix _v;
+    };
+
+    // Return the singular value decomposition of the input matrix.
+    SVD svd(const DenseMatrix& matrix);
+    SVD svd(const Matrix& matrix);
+}
+
+#endif //SRC_SVD_H
@@ -0,0 +1,121 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#include <algorithm>
+#include <memory>
+#include "thread_pool.h"
+#include "workspace.h"
+
+namespace algebra {
+    // True while the current thread is running a task of a pool.
+    static thread_local bool inside_job = false;
+
+    ThreadPool::ThreadPool(size_t threads)
+            : _generation(0), _running(0), _stop(false), _func(nullptr), _count(0), _next(0), _scratch(0) {
+        if (!threads) threads = std::max(1u, std::thread::hardware_concurrency());
+        for (size_t i = 1; i < threads; i++)
+            _workers.emplace_back(&ThreadPool::worker, this);
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _wake.notify_all();
+        for (auto &worker : _workers) worker.join();
+    }
+
+    size_t ThreadPool::size() const {
+        return _workers.size() + 1;
+    }
+
+    void ThreadPool::parallel_for(size_t count, Task func) {
+        // Run serially when there is nothing to share or when called from a task.
+        if (count <= 1 || _workers.empty() || inside_job) {
+            for (size_t i = 0; i < count; i++) func(i);
+            return;
+        }
+        std::lock_guard<std::mutex> job(_job_mutex);
+        // Publish the job and wake up the workers.
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _func = &func;
+            _count = count;
+            _next = 0;
+            _error = nullptr;
+            _running = _workers.size();
+            _generation++;
+        }
+        _wake.notify_all();
+        // The caller works too.
+        run_tasks();
+        // Wait for the workers to leave the job.
+        std::unique_lock<std::mutex> lock(_mutex);
+        _finished.wait(lock, [this] { return _running == 0; });
+        _func = nullptr;
+        if (_error) std::rethrow_exception(_error);
+    }
+
+    void ThreadPool::worker() {
+        size_t seen = 0;
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true) {
+            _wake.wait(lock, [&] { return _stop || _generation != seen; });
+            if (_stop) return;
+            seen = _generation;
+            lock.unlock();
+            run_tasks();
+            lock.lock();
+            // The last worker leaving the job wakes up the caller.
+            if (--_running == 0) _finished.notify_all();
+        }
+    }
+
+    void ThreadPool::run_tasks() {
+        Workspace &workspace = Workspace::local();
+        workspace.reserve(_scratch);
+        size_t used = workspace.used();
+        workspace.reset_peak();
+        inside_job = true;
+        for (size_t i; (i = _next.fetch_add(1)) < _count;) {
+            try {
+                (*_func)(i);
+            } catch (...) {
+                // Keep the first error, the other tasks still run.
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_error) _error = std::current_exception();
+            }
+        }
+        inside_job = false;
+        // Raise the room every thread makes if the tasks of this thread took more.
+        size_t taken = workspace.peak() - used, scratch = _scratch;
+        while (taken > scratch && !_scratch.compare_exchange_weak(scratch, taken)) {}
+    }
+
+    // The shared pool, created on first use.
+    static std::unique_ptr<ThreadPool> &shared_pool() {
+        static std::unique_ptr<ThreadPool> pool;
+        return pool;
+    }
+
+    static std::mutex shared_pool_mutex;
+
+    void set_num_threads(size_t threads) {
+        std::lock_guard<std::mutex> lock(shared_pool_mutex);
+        shared_pool().reset();
+        shared_pool().reset(new ThreadPool(threads));
+    }
+
+    size_t get_num_threads() {
+        return thread_pool().size();
+    }
+
+    ThreadPool &thread_pool() {
+        std::lock_guard<std::mutex> lock(shared_pool_mutex);
+        if (!shared_pool()) shared_pool().reset(new ThreadPool(0));
+        return *shared_pool();
+    }
+}
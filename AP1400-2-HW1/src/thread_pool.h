@@ -0,0 +1,101 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_THREAD_POOL_H
+#define SRC_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace algebra {
+    // A fixed set of worker threads which is reused by every parallel kernel.
+    // The calling thread takes part in the work, so a pool of n threads owns n - 1 workers.
+    class ThreadPool {
+    public:
+        // A reference to the function of a job. It neither copies nor owns the function, so starting a job
+        // does not allocate; the function must outlive the call of parallel_for, as a lambda argument does.
+        class Task {
+        public:
+            template<typename Func>
+            Task(const Func &func)
+                    : _object(&func), _call([](const void *object, size_t i) {
+                (*static_cast<const Func *>(object))(i);
+            }) {}
+
+            void operator()(size_t i) const {
+                _call(_object, i);
+            }
+
+        private:
+            const void *_object;
+            void (*_call)(const void *object, size_t i);
+        };
+
+        // Constructor that starts threads - 1 workers, 0 means one per hardware thread.
+        explicit ThreadPool(size_t threads);
+
+        // Copy and move are forbidden, the workers keep a pointer to the pool.
+        ThreadPool(const ThreadPool &other) = delete;
+        ThreadPool &operator=(const ThreadPool &other) = delete;
+
+        // Destructor that stops and joins the workers.
+        ~ThreadPool();
+
+        // Return the number of threads working on a job, the caller included.
+        size_t size() const;
+
+        // Call func(i) for every i in [0, count) and return when all calls are finished.
+        // The first exception thrown by func is rethrown in the caller.
+        // Calls made from inside a running job are executed serially by the current thread.
+        void parallel_for(size_t count, Task func);
+
+    private:
+        // The worker threads.
+        std::vector<std::thread> _workers;
+        // Only one job runs at a time.
+        std::mutex _job_mutex;
+        // Protect the fields below and wake up the workers.
+        std::mutex _mutex;
+        std::condition_variable _wake;
+        std::condition_variable _finished;
+        // Increased by each job, a worker runs a job when it sees a new generation.
+        size_t _generation;
+        // The number of workers still busy with the current job.
+        size_t _running;
+        // Set to stop the workers.
+        bool _stop;
+        // The current job.
+        const Task *_func;
+        size_t _count;
+        std::atomic<size_t> _next;
+        std::exception_ptr _error;
+        // The most scratch memory one thread has taken during a job. Every thread makes room for it before
+        // it runs the tasks of a job, so which thread runs which task does not change what is taken from
+        // the system once the jobs have run on every thread.
+        std::atomic<size_t> _scratch;
+
+        // The loop of a worker thread.
+        void worker();
+
+        // Take indices of the current job until there is no one left.
+        void run_tasks();
+    };
+
+    // Set the number of threads used by the algebra kernels, 0 means one per hardware thread.
+    // Must not be called while a kernel is running.
+    void set_num_threads(size_t threads);
+
+    // Return the number of threads used by the algebra kernels.
+    size_t get_num_threads();
+
+    // Return the pool shared by the algebra kernels.
+    ThreadPool &thread_pool();
+}
+
+#endif //SRC_THREAD_POOL_H
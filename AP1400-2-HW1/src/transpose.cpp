@@ -0,0 +1,76 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#include <algorithm>
+#include <utility>
+#include "transpose.h"
+// Last, the instructions of the variant apply to the code below it only.
+#include "isa.h"
+
+using std::min;
+
+namespace algebra {
+    namespace kernel {
+        namespace ALGEBRA_ISA {
+            // Transpose one tile of at most block*block elements by micro tiles.
+            template <typename T>
+            static void transpose_tile(size_t ib, size_t ie, size_t jb, size_t je,
+                                       const T *src, size_t lds, T *dst, size_t ldd) {
+                for (size_t jm = jb; jm < je; jm += transpose_micro) {
+                    size_t jme = min(je, jm + transpose_micro);
+                    for (size_t im = ib; im < ie; im += transpose_micro) {
+                        size_t ime = min(ie, im + transpose_micro);
+                        for (size_t j = jm; j < jme; j++) {
+                            T *out = dst + j * ldd;
+                            for (size_t i = im; i < ime; i++) out[i] = src[i * lds + j];
+                        }
+                    }
+                }
+            }
+
+            template <typename T>
+            static void transpose_blocked(size_t rows, size_t cols, const T *src, size_t lds, T *dst, size_t ldd) {
+                // Walk the tiles, inside a tile both the reads and the writes stay in a few cache lines.
+                for (size_t ib = 0; ib < rows; ib += transpose_block) {
+                    size_t ie = min(rows, ib + transpose_block);
+                    for (size_t jb = 0; jb < cols; jb += transpose_block)
+                        transpose_tile(ib, ie, jb, min(cols, jb + transpose_block), src, lds, dst, ldd);
+                }
+            }
+
+            template <typename T>
+            static void transpose_square(size_t n, T *a, size_t lda) {
+                // Walk the micro tiles on and above the diagonal, each one is swapped with its mirror.
+                for (size_t ib = 0; ib < n; ib += transpose_micro) {
+                    size_t ie = min(n, ib + transpose_micro);
+                    // The diagonal micro tile is transposed within itself.
+                    for (size_t i = ib; i < ie; i++)
+                        for (size_t j = i + 1; j < ie; j++) std::swap(a[i * lda + j], a[j * lda + i]);
+                    for (size_t jb = ie; jb < n; jb += transpose_micro) {
+                        size_t je = min(n, jb + transpose_micro);
+                        for (size_t i = ib; i < ie; i++)
+                            for (size_t j = jb; j < je; j++) std::swap(a[i * lda + j], a[j * lda + i]);
+                    }
+                }
+            }
+
+            void transpose(size_t rows, size_t cols, const double *src, size_t lds, double *dst, size_t ldd) {
+                transpose_blocked(rows, cols, src, lds, dst, ldd);
+            }
+
+            void transpose(size_t rows, size_t cols, const float *src, size_t lds, float *dst, size_t ldd) {
+                transpose_blocked(rows, cols, src, lds, dst, ldd);
+            }
+
+            void transpose_in_place(size_t n, double *a, size_t lda) {
+                transpose_square(n, a, lda);
+            }
+
+            void transpose_in_place(size_t n, float *a, size_t lda) {
+                transpose_square(n, a, lda);
+            }
+        }
+    }
+}
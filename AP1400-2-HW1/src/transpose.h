@@ -0,0 +1,32 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_TRANSPOSE_H
+#define SRC_TRANSPOSE_H
+
+#include <cstddef>
+
+// The cache blocked kernels behind algebra::transpose.
+namespace algebra {
+    namespace kernel {
+        // The edge of the square tiles, a source and a destination tile fit in L2 together.
+        constexpr size_t transpose_block = 64;
+
+        // The edge of the micro tiles inside a tile, one cache line of doubles.
+        // Small enough to avoid the set conflicts of power-of-two strides.
+        constexpr size_t transpose_micro = 8;
+
+        // Write the transpose of the rows*cols matrix src into the cols*rows matrix dst.
+        // Both are row-major with the given leading dimensions, they must not overlap.
+        void transpose(size_t rows, size_t cols, const double *src, size_t lds, double *dst, size_t ldd);
+        void transpose(size_t rows, size_t cols, const float *src, size_t lds, float *dst, size_t ldd);
+
+        // Transpose the n*n matrix a in place.
+        void transpose_in_place(size_t n, double *a, size_t lda);
+        void transpose_in_place(size_t n, float *a, size_t lda);
+    }
+}
+
+#endif //SRC_TRANSPOSE_H
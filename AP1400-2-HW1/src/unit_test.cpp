@@ -336,16 +336,970 @@ TEST(HW1Test, UPPER_TRIANGULAR1) {
     // test case 1
     Matrix matrix1{{1, 2}, {5, 7}};
     Matrix res1{algebra::upper_triangular(matrix1)};
-    EXPECT_NEAR(res1[0][0], 1, 0.03);
+    EXPECT_NEAR(res1[0][0], 5, 0.03);
     EXPECT_NEAR(res1[1][0], 0, 0.03);
-    EXPECT_NEAR(res1[1][1], -3, 0.03);
+    EXPECT_NEAR(res1[1][1], 0.6, 0.03);
 
     // test case 2
     Matrix matrix2{{1, 2, 3}, {4, 7, 5}, {6, 1, 3}};
     Matrix res2{algebra::upper_triangular(matrix2)};
-    EXPECT_NEAR(res2[0][0], 1, 0.03);
+    EXPECT_NEAR(res2[0][0], 6, 0.03);
     EXPECT_NEAR(res2[1][0], 0, 0.03);
     EXPECT_NEAR(res2[2][0], 0, 0.03);
     EXPECT_NEAR(res2[2][1], 0, 0.03);
-    EXPECT_NEAR(res2[2][2], 62, 0.03);
+    EXPECT_NEAR(res2[2][2], 31.0 / 19, 0.03);
+    EXPECT_NEAR(res2[0][0] * res2[1][1] * res2[2][2], 62, 0.03);
+}
+
+TEST(HW1Test, DENSE_MATRIX1) {
+    // Caution: rows with different length cannot be converted
+    EXPECT_THROW(algebra::DenseMatrix(Matrix{{1, 2}, {3}}), std::logic_error);
+
+    Matrix matrix{algebra::random(5, 3, -2, 2)};
+    algebra::DenseMatrix dense{matrix};
+
+    // check the shape and the layout of the matrix
+    EXPECT_EQ(dense.rows(), 5);
+    EXPECT_EQ(dense.cols(), 3);
+    EXPECT_GE(dense.stride(), 3);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(dense.data()) % algebra::DenseMatrix::alignment, 0);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(dense.row(1)) % algebra::DenseMatrix::alignment, 0);
+
+    // check the round trip of the conversion
+    EXPECT_TRUE(dense.to_matrix() == matrix);
+    EXPECT_TRUE(algebra::DenseMatrix(2, 2, 1) == (algebra::DenseMatrix{{1, 1}, {1, 1}}));
+}
+
+TEST(HW1Test, DENSE_MATRIX2) {
+    Matrix matrix1{{-1, 1.5, -1.75, -2}, {-2, 2.5, -2.75, -3}, {3, 3.5, -3.75, -4}, {4, 4.5, 4.75, -5}};
+    Matrix matrix2{algebra::random(4, 2, -3, 3)};
+    algebra::DenseMatrix dense1{matrix1}, dense2{matrix2};
+
+    // check the results are the same as the Matrix ones
+    EXPECT_TRUE(algebra::multiply(dense1, dense2).to_matrix() == algebra::multiply(matrix1, matrix2));
+    EXPECT_TRUE(algebra::sum(dense1, 1.5).to_matrix() == algebra::sum(matrix1, 1.5));
+    EXPECT_TRUE(algebra::transpose(dense2).to_matrix() == algebra::transpose(matrix2));
+    EXPECT_TRUE(algebra::concatenate(dense1, dense2, 1).to_matrix() == algebra::concatenate(matrix1, matrix2, 1));
+    EXPECT_NEAR(algebra::determinant(dense1), -28.5, 0.03);
+
+    // Caution: matrices with wrong dimensions cannot be multiplied
+    EXPECT_THROW(algebra::multiply(dense2, dense1), std::logic_error);
+}
+
+TEST(HW1Test, MULTIPLY5) {
+    // test case: the sizes are not multiples of the tiles of the kernel
+    Matrix matrix1{algebra::random(133, 301, -1, 1)};
+    Matrix matrix2{algebra::random(301, 37, -1, 1)};
+    Matrix matrix{algebra::multiply(matrix1, matrix2)};
+
+    // check the size of the matrix
+    EXPECT_EQ(matrix.size(), 133);
+    EXPECT_EQ(matrix[0].size(), 37);
+
+    // check the value of the elements against the definition
+    for (size_t i{}; i < matrix.size(); i += 11)
+        for (size_t j{}; j < matrix[i].size(); j += 5) {
+            double expected{};
+            for (size_t k{}; k < matrix2.size(); k++)
+                expected += matrix1[i][k] * matrix2[k][j];
+            EXPECT_NEAR(matrix[i][j], expected, 1e-9);
+        }
+}
+
+TEST(HW1Test, THREAD_POOL) {
+    algebra::ThreadPool pool(4);
+    EXPECT_EQ(pool.size(), 4);
+
+    // check every index is visited exactly once
+    std::vector<int> visited(1000);
+    pool.parallel_for(visited.size(), [&](size_t i) { visited[i]++; });
+    for (int v : visited)
+        EXPECT_EQ(v, 1);
+
+    // Caution: an exception in a task is thrown in the caller
+    EXPECT_THROW(pool.parallel_for(10, [](size_t i) { if (i == 7) throw std::logic_error("task"); }),
+                 std::logic_error);
+}
+
+TEST(HW1Test, MULTIPLY_PARALLEL) {
+    algebra::DenseMatrix matrix1(300, 200), matrix2(200, 700);
+    algebra::random(matrix1, -1, 1);
+    algebra::random(matrix2, -1, 1);
+
+    // the tiles are computed in the same order, so the results are identical
+    algebra::set_num_threads(1);
+    algebra::DenseMatrix serial{algebra::multiply(matrix1, matrix2)};
+    algebra::set_num_threads(4);
+    EXPECT_EQ(algebra::get_num_threads(), 4);
+    EXPECT_TRUE(algebra::multiply(matrix1, matrix2) == serial);
+    algebra::set_num_threads(0);
+}
+
+TEST(HW1Test, LU) {
+    // Caution: non-square matrices have no LU factorization
+    EXPECT_THROW(algebra::lu(Matrix{{1, 2, 3}, {4, 5, 6}}), std::logic_error);
+
+    // test case: P * A = L * U
+    Matrix matrix{{-1, 1.5, -1.75, -2}, {-2, 2.5, -2.75, -3}, {3, 3.5, -3.75, -4}, {4, 4.5, 4.75, -5}};
+    algebra::LU lu{algebra::lu(matrix)};
+    Matrix product{algebra::multiply(lu.lower(), lu.upper()).to_matrix()};
+    for (size_t i{}; i < matrix.size(); i++)
+        for (size_t j{}; j < matrix.size(); j++)
+            EXPECT_NEAR(product[i][j], matrix[lu.pivot()[i]][j], 1e-12);
+    EXPECT_FALSE(lu.singular());
+    EXPECT_NEAR(lu.determinant(), -28.5, 1e-12);
+
+    // test case: a tiny pivot is not an exact zero, only inverse and solve refuse it
+    algebra::LU tiny{algebra::lu(Matrix{{1, 0}, {0, 1e-17}})};
+    EXPECT_TRUE(tiny.singular());
+    EXPECT_DOUBLE_EQ(tiny.determinant(), 1e-17);
+    EXPECT_THROW(tiny.inverse(), std::logic_error);
+    EXPECT_DOUBLE_EQ(algebra::determinant(Matrix{{1e-100, 0}, {0, 1e100}}), 1);
+    EXPECT_EQ(algebra::determinant(Matrix{{1, 2}, {2, 4}}), 0);
+}
+
+TEST(HW1Test, DETERMINANT3) {
+    // test case: a large matrix, the determinant of a triangular matrix is the product of its diagonal
+    Matrix matrix{algebra::random(200, 200, -1, 1)};
+    double expected{1};
+    for (size_t i{}; i < matrix.size(); i++) {
+        matrix[i][i] = 1.5 + i % 3 * 0.25;
+        expected *= matrix[i][i];
+        std::fill(matrix[i].begin() + i + 1, matrix[i].end(), 0);
+    }
+    EXPECT_NEAR(algebra::determinant(matrix) / expected, 1, 1e-9);
+}
+
+TEST(HW1Test, INVERSE3) {
+    // test case: a large matrix times its inverse is the identity
+    Matrix matrix{algebra::random(120, 120, -1, 1)};
+    for (size_t i{}; i < matrix.size(); i++)
+        matrix[i][i] += 10;
+    Matrix identity{algebra::multiply(matrix, algebra::inverse(matrix))};
+    for (size_t i{}; i < identity.size(); i++)
+        for (size_t j{}; j < identity[i].size(); j++)
+            EXPECT_NEAR(identity[i][j], i == j ? 1 : 0, 1e-9);
+
+    // Caution: a nearly singular matrix is reported by its condition number
+    Matrix ill{{1, 1}, {1, 1 + 1e-17}};
+    EXPECT_THROW(algebra::inverse(ill), std::logic_error);
+    EXPECT_NEAR(algebra::lu(Matrix{{2, 0}, {0, 2}}).rcond(), 1, 1e-12);
+    EXPECT_LT(algebra::lu(Matrix{{1, 1}, {1, 1 + 1e-10}}).rcond(), 1e-9);
+}
+
+TEST(HW1Test, ERO_IN_PLACE) {
+    // Caution: r1 or r2 inputs are out of range
+    Matrix small{{1, 2}};
+    EXPECT_THROW(algebra::ero_swap_in_place(small, 0, 1), std::logic_error);
+
+    // test case: the in-place operations give the same results as the pure ones
+    Matrix matrix{algebra::random(4, 3, 0, 4)};
+    Matrix ero{matrix};
+    algebra::ero_swap_in_place(ero, 1, 3);
+    EXPECT_TRUE(ero == algebra::ero_swap(matrix, 1, 3));
+    algebra::ero_multiply_in_place(ero, 2, 1.5);
+    EXPECT_TRUE(ero == algebra::ero_multiply(algebra::ero_swap(matrix, 1, 3), 2, 1.5));
+
+    algebra::DenseMatrix dense{matrix};
+    algebra::ero_sum_in_place(dense, 0, 2, 3);
+    EXPECT_TRUE(dense.to_matrix() == algebra::ero_sum(matrix, 0, 2, 3));
+
+    // test case: the largest element of each column is swapped onto the diagonal
+    algebra::DenseMatrix upper{{0, 2, 1}, {1, 1, 1}, {2, 0, 3}};
+    std::vector<size_t> permutation = algebra::upper_triangular_in_place(upper);
+    EXPECT_EQ(permutation, (std::vector<size_t>{2, 0, 1}));
+    EXPECT_NEAR(upper(0, 0), 2, 1e-12);
+    EXPECT_NEAR(upper(1, 0), 0, 1e-12);
+    EXPECT_NEAR(upper(2, 0), 0, 1e-12);
+    EXPECT_NEAR(upper(2, 1), 0, 1e-12);
+    // Two swaps, the product of the diagonal is the determinant.
+    EXPECT_NEAR(upper(0, 0) * upper(1, 1) * upper(2, 2), -4, 1e-12);
+}
+
+TEST(HW1Test, EXPRESSION) {
+    using algebra::expression::lazy;
+
+    // Caution: matrices with wrong dimensions cannot be summed
+    Matrix wrong{{1, 2, 3}};
+    Matrix square{{1, 2}, {3, 4}};
+    EXPECT_THROW(lazy(wrong) + lazy(square), std::logic_error);
+
+    // test case: the fused expression gives the same result as the eager functions
+    algebra::DenseMatrix matrix1(3, 5), matrix2(5, 3);
+    algebra::random(matrix1, -2, 2);
+    algebra::random(matrix2, -2, 2);
+    algebra::DenseMatrix eager{algebra::sum(algebra::sum(algebra::multiply(matrix1, 2.0),
+                                                         algebra::multiply(algebra::transpose(matrix2), 3.0)), 1.5)};
+    algebra::DenseMatrix fused{evaluate(2.0 * lazy(matrix1) + transpose(lazy(matrix2)) * 3.0 + 1.5)};
+    EXPECT_EQ(fused.rows(), 3);
+    EXPECT_EQ(fused.cols(), 5);
+    for (size_t i{}; i < fused.rows(); i++)
+        for (size_t j{}; j < fused.cols(); j++)
+            EXPECT_NEAR(fused(i, j), eager(i, j), 1e-12);
+
+    // test case: a Matrix can be a leaf too
+    EXPECT_TRUE(evaluate(lazy(square) * 2.0).to_matrix() == algebra::multiply(square, 2.0));
+}
+
+TEST(HW1Test, ELEMENTWISE) {
+    // test case: the lengths cover the vector bodies and the scalar tails
+    for (size_t cols : {1, 3, 8, 17, 33}) {
+        algebra::DenseMatrix matrix1(5, cols), matrix2(5, cols);
+        algebra::random(matrix1, -3, 3);
+        algebra::random(matrix2, -3, 3);
+        algebra::DenseMatrix mult{algebra::multiply(matrix1, -2.5)};
+        algebra::DenseMatrix shift{algebra::sum(matrix1, 0.75)};
+        algebra::DenseMatrix sum{algebra::sum(matrix1, matrix2)};
+        for (size_t i{}; i < matrix1.rows(); i++) {
+            for (size_t j{}; j < cols; j++) {
+                EXPECT_DOUBLE_EQ(mult(i, j), matrix1(i, j) * -2.5);
+                EXPECT_DOUBLE_EQ(shift(i, j), matrix1(i, j) + 0.75);
+                EXPECT_DOUBLE_EQ(sum(i, j), matrix1(i, j) + matrix2(i, j));
+            }
+            // check the padding stays zero
+            for (size_t j{cols}; j < shift.stride(); j++)
+                EXPECT_EQ(shift.row(i)[j], 0);
+        }
+    }
+}
+
+TEST(HW1Test, TRANSPOSE_IN_PLACE) {
+    // Caution: only square matrices can be transposed in place
+    algebra::DenseMatrix wrong(2, 3);
+    EXPECT_THROW(algebra::transpose_in_place(wrong), std::logic_error);
+
+    // test case: the sizes are not multiples of the tiles
+    algebra::DenseMatrix matrix(70, 70);
+    algebra::random(matrix, -1, 1);
+    algebra::DenseMatrix transpose{matrix};
+    algebra::transpose_in_place(transpose);
+    EXPECT_TRUE(transpose == algebra::transpose(matrix));
+    for (size_t i{}; i < matrix.rows(); i++)
+        for (size_t j{}; j < matrix.cols(); j++)
+            EXPECT_DOUBLE_EQ(transpose(i, j), matrix(j, i));
+
+    Matrix small{{1, 2}, {3, 4}};
+    algebra::transpose_in_place(small);
+    EXPECT_TRUE(small == algebra::transpose(Matrix{{1, 2}, {3, 4}}));
+
+    // test case: a tall matrix crosses several tiles
+    algebra::DenseMatrix tall(100, 45);
+    algebra::random(tall, -1, 1);
+    algebra::DenseMatrix tall_t{algebra::transpose(tall)};
+    for (size_t i{}; i < tall.rows(); i++)
+        for (size_t j{}; j < tall.cols(); j++)
+            EXPECT_DOUBLE_EQ(tall_t(j, i), tall(i, j));
+}
+
+TEST(HW1Test, VIEW_MINOR) {
+    algebra::DenseMatrix matrix{{7, 2.5, 3.1, 1}, {4.2, 5, 10.4, 2}, {70.7, 8, 0, 3}, {1, 2, 3, 4}};
+
+    // Caution: n or m out of range
+    EXPECT_THROW(algebra::minor(algebra::View(matrix), 4, 0), std::logic_error);
+
+    // test case: every minor view matches the copied minor
+    for (size_t n{}; n < matrix.rows(); n++) {
+        for (size_t m{}; m < matrix.cols(); m++) {
+            algebra::View view{algebra::minor(algebra::View(matrix), n, m)};
+            EXPECT_LE(view.block_count(), 4);
+            EXPECT_TRUE(view.to_dense() == algebra::minor(matrix, n, m));
+            EXPECT_NEAR(algebra::determinant(view), algebra::determinant(algebra::minor(matrix, n, m)), 1e-9);
+        }
+    }
+
+    // test case: the minor of a minor
+    algebra::View twice{algebra::minor(algebra::minor(algebra::View(matrix), 1, 2), 0, 0)};
+    EXPECT_TRUE(twice.to_dense() == algebra::minor(algebra::minor(matrix, 1, 2), 0, 0));
+    EXPECT_DOUBLE_EQ(twice(1, 0), 2);
+}
+
+TEST(HW1Test, VIEW_CONCATENATE) {
+    algebra::DenseMatrix matrix1(2, 3), matrix2(4, 3), matrix3(6, 2);
+    algebra::random(matrix1, 0, 1);
+    algebra::random(matrix2, 0, 1);
+    algebra::random(matrix3, 0, 1);
+
+    // Caution: views with wrong dimensions cannot be concatenated
+    EXPECT_THROW(algebra::concatenate(algebra::View(matrix1), algebra::View(matrix2), 1), std::logic_error);
+
+    // test case: the stacked views match the copied concatenations
+    algebra::View stacked{algebra::concatenate(algebra::View(matrix1), algebra::View(matrix2), 0)};
+    algebra::DenseMatrix copied{algebra::concatenate(matrix1, matrix2, 0)};
+    EXPECT_TRUE(stacked.to_dense() == copied);
+    algebra::View wide{algebra::concatenate(stacked, algebra::View(matrix3), 1)};
+    algebra::DenseMatrix wide_copied{algebra::concatenate(copied, matrix3, 1)};
+    EXPECT_TRUE(wide.to_dense() == wide_copied);
+
+    // test case: the algebra functions read the pieces directly
+    EXPECT_TRUE(algebra::transpose(wide) == algebra::transpose(wide_copied));
+    EXPECT_TRUE(algebra::multiply(wide, 2.0) == algebra::multiply(wide_copied, 2.0));
+    EXPECT_TRUE(algebra::sum(wide, 1.5) == algebra::sum(wide_copied, 1.5));
+    EXPECT_TRUE(algebra::sum(wide, algebra::View(wide_copied)) == algebra::sum(wide_copied, wide_copied));
+    algebra::DenseMatrix product{algebra::multiply(algebra::transpose(wide_copied), wide_copied)};
+    algebra::DenseMatrix view_product{algebra::multiply(algebra::View(algebra::transpose(wide_copied)), wide)};
+    for (size_t i{}; i < product.rows(); i++)
+        for (size_t j{}; j < product.cols(); j++)
+            EXPECT_NEAR(view_product(i, j), product(i, j), 1e-12);
+
+    // test case: a row slice and the lazy expressions
+    algebra::View rows{algebra::slice_rows(wide, 1, 3)};
+    EXPECT_EQ(rows.rows(), 3);
+    EXPECT_DOUBLE_EQ(rows(0, 4), matrix3(1, 1));
+    algebra::DenseMatrix lazy{algebra::expression::evaluate(rows * 2.0 + 1.0)};
+    EXPECT_DOUBLE_EQ(lazy(2, 0), matrix2(1, 0) * 2 + 1);
+}
+
+TEST(HW1Test, RANDOM_SEEDED) {
+    using algebra::Distribution;
+
+    // check the generator against the known answer of Philox4x32-10
+    std::array<uint32_t, 4> words{algebra::Philox(0)(0)};
+    EXPECT_EQ(words[0], 0x6627e8d5u);
+    EXPECT_EQ(words[1], 0xe169c58du);
+    EXPECT_EQ(words[2], 0xbc57ac4cu);
+    EXPECT_EQ(words[3], 0x9b00dbd8u);
+
+    // Caution: min cannot be greater than max
+    algebra::DenseMatrix wrong(2, 2);
+    EXPECT_THROW(algebra::random(wrong, Distribution::uniform, 4, 2, 1), std::logic_error);
+
+    // test case: the same seed gives the same matrix for any number of threads
+    algebra::DenseMatrix matrix1(301, 517), matrix2(301, 517), matrix3(301, 517);
+    algebra::set_num_threads(1);
+    algebra::random(matrix1, Distribution::uniform, -5, 7, 42);
+    algebra::set_num_threads(4);
+    algebra::random(matrix2, Distribution::uniform, -5, 7, 42);
+    algebra::random(matrix3, Distribution::uniform, -5, 7, 43);
+    algebra::set_num_threads(0);
+    EXPECT_TRUE(matrix1 == matrix2);
+    EXPECT_FALSE(matrix1 == matrix3);
+    for (size_t i{}; i < matrix1.rows(); i++)
+        for (size_t j{}; j < matrix1.cols(); j++) {
+            EXPECT_GE(matrix1(i, j), -5);
+            EXPECT_LT(matrix1(i, j), 7);
+        }
+
+    // test case: the moments of the normal distribution
+    algebra::DenseMatrix normal(500, 400);
+    algebra::random(normal, Distribution::normal, 2, 3, 7);
+    double mean{}, square{};
+    for (size_t i{}; i < normal.rows(); i++)
+        for (size_t j{}; j < normal.cols(); j++) {
+            mean += normal(i, j);
+            square += normal(i, j) * normal(i, j);
+        }
+    mean /= 200000;
+    EXPECT_NEAR(mean, 2, 0.03);
+    EXPECT_NEAR(std::sqrt(square / 200000 - mean * mean), 3, 0.03);
+}
+
+TEST(HW1Test, MATRIX_IO) {
+    std::string path = testing::TempDir() + "matrix_io.bin";
+
+    // test case: a saved matrix maps back with the same elements and an aligned buffer
+    algebra::DenseMatrix matrix(37, 13);
+    algebra::random(matrix, algebra::Distribution::uniform, -5, 7, 1);
+    algebra::save(path, matrix);
+    algebra::DenseMatrix loaded = algebra::load(path);
+    EXPECT_TRUE(loaded == matrix);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(loaded.data()) % algebra::DenseMatrix::alignment, 0u);
+    EXPECT_DOUBLE_EQ(algebra::determinant(algebra::multiply(loaded, algebra::transpose(loaded))),
+                     algebra::determinant(algebra::multiply(matrix, algebra::transpose(matrix))));
+
+    // test case: the streaming writer gives the same file row by row
+    algebra::MatrixWriter writer(path, 3, 2);
+    double row[]{1, 2};
+    writer.write_row(row);
+    writer.write_rows(algebra::DenseMatrix{{3, 4}, {5, 6}});
+    EXPECT_THROW(writer.write_row(row), std::logic_error);
+    writer.close();
+    EXPECT_TRUE(algebra::load(path) == (algebra::DenseMatrix{{1, 2}, {3, 4}, {5, 6}}));
+    algebra::MatrixWriter incomplete(path, 3, 2);
+    EXPECT_THROW(incomplete.close(), std::logic_error);
+
+    // test case: the vector-of-vectors matrix and the empty matrix
+    Matrix nested{{1, 2, 3}, {4, 5, 6}};
+    algebra::save(path, nested);
+    EXPECT_EQ(algebra::load(path).to_matrix(), nested);
+    algebra::save(path, Matrix{});
+    EXPECT_TRUE(algebra::load(path).empty());
+
+    // test case: invalid files
+    std::FILE *file = std::fopen(path.c_str(), "wb");
+    std::fputs("not a matrix file, but long enough to hold a whole header of 64 bytes", file);
+    std::fclose(file);
+    EXPECT_THROW(algebra::load(path), std::runtime_error);
+    EXPECT_THROW(algebra::load(testing::TempDir() + "missing.bin"), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TEST(HW1Test, MULTIPLY_OUT_OF_CORE) {
+    std::string path1 = testing::TempDir() + "out_of_core1.bin";
+    std::string path2 = testing::TempDir() + "out_of_core2.bin";
+    std::string path_result = testing::TempDir() + "out_of_core3.bin";
+
+    // test case: a budget of 16*16 tiles splits all three dimensions into several uneven tiles
+    algebra::DenseMatrix matrix1(53, 41), matrix2(41, 37);
+    algebra::random(matrix1, algebra::Distribution::uniform, -5, 7, 1);
+    algebra::random(matrix2, algebra::Distribution::uniform, -5, 7, 2);
+    algebra::save(path1, matrix1);
+    algebra::save(path2, matrix2);
+    algebra::multiply_out_of_core(path1, path2, path_result, 6 * 16 * 16 * sizeof(double));
+    algebra::DenseMatrix result = algebra::load(path_result);
+    algebra::DenseMatrix expected = algebra::multiply(matrix1, matrix2);
+    ASSERT_EQ(result.rows(), 53u);
+    ASSERT_EQ(result.cols(), 37u);
+    for (size_t i{}; i < expected.rows(); i++)
+        for (size_t j{}; j < expected.cols(); j++)
+            EXPECT_NEAR(result(i, j), expected(i, j), 1e-9);
+
+    // test case: a budget larger than the matrices gives a single tile
+    algebra::multiply_out_of_core(path1, path2, path_result, 1 << 30);
+    EXPECT_TRUE(algebra::load(path_result) == expected);
+
+    // test case: the budget is too small, or the dimensions do not match
+    EXPECT_THROW(algebra::multiply_out_of_core(path1, path2, path_result, 100), std::logic_error);
+    EXPECT_THROW(algebra::multiply_out_of_core(path1, path1, path_result, 1 << 20), std::logic_error);
+    std::remove(path1.c_str());
+    std::remove(path2.c_str());
+    std::remove(path_result.c_str());
+}
+
+TEST(HW1Test, FIXED_MATRIX) {
+    using algebra::FixedMatrix;
+
+    // test case: the functions work in constant expressions
+    constexpr FixedMatrix<2, 3> matrix1{{1, 2, 3}, {4, 5, 6}};
+    constexpr FixedMatrix<3, 2> matrix2{algebra::transpose(matrix1)};
+    constexpr FixedMatrix<2, 2> product{algebra::multiply(matrix1, matrix2)};
+    static_assert(product(0, 0) == 14 && product(0, 1) == 32 && product(1, 1) == 77, "multiply");
+    static_assert(algebra::determinant(product) == 54, "determinant");
+    static_assert(algebra::sum(algebra::multiply(matrix1, 2.0), 1.0)(1, 2) == 13, "multiply and sum");
+    EXPECT_EQ(algebra::multiply(matrix1, matrix2).to_matrix(),
+              algebra::multiply(matrix1.to_matrix(), matrix2.to_matrix()));
+
+    // test case: the closed forms and the elimination agree with the dense functions for every size
+    algebra::DenseMatrix dense(8, 8);
+    algebra::random(dense, algebra::Distribution::uniform, -5, 7, 3);
+    auto check = [&](auto fixed) {
+        constexpr size_t n = decltype(fixed)::rows();
+        algebra::DenseMatrix square{algebra::submatrix(dense, 0, 0, n, n).to_dense()};
+        fixed = decltype(fixed)(square);
+        EXPECT_NEAR(algebra::determinant(fixed), algebra::determinant(square),
+                    1e-9 * std::abs(algebra::determinant(square)));
+        algebra::DenseMatrix inverse = algebra::inverse(square);
+        auto fixed_inverse = algebra::inverse(fixed);
+        for (size_t i{}; i < n; i++)
+            for (size_t j{}; j < n; j++) EXPECT_NEAR(fixed_inverse(i, j), inverse(i, j), 1e-9);
+        EXPECT_TRUE(algebra::sum(fixed, fixed).to_dense() == algebra::sum(square, square));
+    };
+    check(FixedMatrix<1, 1>());
+    check(FixedMatrix<2, 2>());
+    check(FixedMatrix<3, 3>());
+    check(FixedMatrix<4, 4>());
+    check(FixedMatrix<5, 5>());
+    check(FixedMatrix<8, 8>());
+
+    // test case: singular matrices and wrong shapes
+    EXPECT_THROW(algebra::inverse(FixedMatrix<3, 3>{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}), std::logic_error);
+    EXPECT_THROW(algebra::inverse(FixedMatrix<4, 4>()), std::logic_error);
+    EXPECT_THROW(algebra::inverse(FixedMatrix<6, 6>()), std::logic_error);
+    EXPECT_THROW((FixedMatrix<2, 2>{{1, 2}, {3}}), std::logic_error);
+    EXPECT_THROW((FixedMatrix<2, 2>(algebra::DenseMatrix(2, 3))), std::logic_error);
+    EXPECT_THROW((FixedMatrix<2, 2>(Matrix{{1, 2}})), std::logic_error);
+}
+
+TEST(HW1Test, BATCH) {
+    // test case: every matrix of the batches agrees with the single-matrix functions,
+    // with a size that leaves a partial chunk
+    size_t count = 300;
+    algebra::MatrixBatch batch1(count, 4, 4), batch2(count, 4, 3);
+    for (size_t b{}; b < count; b++) {
+        algebra::DenseMatrix matrix1(4, 4), matrix2(4, 3);
+        algebra::random(matrix1, algebra::Distribution::uniform, -5, 7, 2 * b);
+        algebra::random(matrix2, algebra::Distribution::uniform, -5, 7, 2 * b + 1);
+        batch1.set(b, matrix1);
+        batch2.set(b, matrix2);
+    }
+    algebra::MatrixBatch product = algebra::multiply_batch(batch1, batch2);
+    algebra::MatrixBatch inverse = algebra::inverse_batch(batch1);
+    std::vector<double> determinant = algebra::determinant_batch(batch1);
+    ASSERT_EQ(product.size(), count);
+    ASSERT_EQ(determinant.size(), count);
+    for (size_t b{}; b < count; b++) {
+        algebra::DenseMatrix matrix1 = batch1.get(b);
+        algebra::DenseMatrix expected = algebra::multiply(matrix1, batch2.get(b));
+        algebra::DenseMatrix expected_inverse = algebra::inverse(matrix1);
+        for (size_t i{}; i < 4; i++) {
+            for (size_t j{}; j < 3; j++) EXPECT_NEAR(product(b, i, j), expected(i, j), 1e-12);
+            for (size_t j{}; j < 4; j++) EXPECT_NEAR(inverse(b, i, j), expected_inverse(i, j), 1e-9);
+        }
+        EXPECT_NEAR(determinant[b], algebra::determinant(matrix1), 1e-9 * std::abs(determinant[b]));
+    }
+
+    // test case: a singular matrix in the batch
+    batch1.set(7, algebra::DenseMatrix{{1, 2, 3, 4}, {2, 4, 6, 8}, {0, 1, 0, 1}, {1, 0, 1, 0}});
+    EXPECT_EQ(algebra::determinant_batch(batch1)[7], 0);
+    EXPECT_THROW(algebra::inverse_batch(batch1), std::logic_error);
+
+    // test case: tiny pivots keep their determinant, as in algebra::determinant
+    algebra::MatrixBatch tiny(2, 2, 2);
+    tiny.set(0, algebra::DenseMatrix{{1, 0}, {0, 1e-17}});
+    tiny.set(1, algebra::DenseMatrix{{1e-100, 0}, {0, 1e100}});
+    std::vector<double> tiny_determinant = algebra::determinant_batch(tiny);
+    EXPECT_DOUBLE_EQ(tiny_determinant[0], 1e-17);
+    EXPECT_DOUBLE_EQ(tiny_determinant[1], 1);
+    EXPECT_THROW(algebra::inverse_batch(tiny), std::logic_error);
+
+    // test case: wrong shapes
+    EXPECT_THROW(algebra::multiply_batch(batch2, batch2), std::logic_error);
+    EXPECT_THROW(algebra::multiply_batch(batch1, algebra::MatrixBatch(count - 1, 4, 3)), std::logic_error);
+    EXPECT_THROW(algebra::inverse_batch(batch2), std::logic_error);
+    EXPECT_THROW(algebra::determinant_batch(batch2), std::logic_error);
+    EXPECT_THROW(batch1.set(0, algebra::DenseMatrix(3, 4)), std::logic_error);
+}
+
+TEST(HW1Test, SINGLE_PRECISION) {
+    // test case: the float functions agree with the double ones up to float rounding
+    algebra::DenseMatrix matrix1(70, 50), matrix2(50, 30);
+    algebra::random(matrix1, algebra::Distribution::uniform, -1, 1, 1);
+    algebra::random(matrix2, algebra::Distribution::uniform, -1, 1, 2);
+    algebra::DenseMatrixF float1(matrix1), float2(matrix2);
+    algebra::DenseMatrix product = algebra::multiply(matrix1, matrix2);
+    algebra::DenseMatrixF float_product = algebra::multiply(float1, float2);
+    for (size_t i{}; i < product.rows(); i++)
+        for (size_t j{}; j < product.cols(); j++) EXPECT_NEAR(float_product(i, j), product(i, j), 1e-4);
+    EXPECT_TRUE(algebra::DenseMatrixF(algebra::transpose(matrix1)) == algebra::transpose(float1));
+    algebra::DenseMatrixF shifted = algebra::sum(algebra::multiply(float1, 2.0), 1.0);
+    EXPECT_FLOAT_EQ(shifted(3, 4), 2 * float1(3, 4) + 1);
+    algebra::DenseMatrixF square = algebra::DenseMatrixF{{2, 1, 0}, {1, 3, 1}, {0, 1, 4}};
+    EXPECT_DOUBLE_EQ(algebra::determinant(square), 18);
+    algebra::DenseMatrixF identity = algebra::multiply(square, algebra::inverse(square));
+    for (size_t i{}; i < 3; i++)
+        for (size_t j{}; j < 3; j++) EXPECT_NEAR(identity(i, j), i == j, 1e-6);
+    algebra::DenseMatrixF upper = algebra::upper_triangular(square);
+    EXPECT_NEAR(upper(2, 1), 0, 1e-6);
+    EXPECT_NEAR(upper(2, 2), 3.6, 1e-6);
+
+    // test case: the mixed product is the double product rounded once
+    size_t n = 2000;
+    algebra::DenseMatrixF row(1, n), col(n, 1);
+    algebra::random(row, algebra::Distribution::uniform, 0, 1, 3);
+    algebra::random(col, algebra::Distribution::uniform, 0, 1, 4);
+    double exact = algebra::multiply(algebra::DenseMatrix(row), algebra::DenseMatrix(col))(0, 0);
+    double mixed = algebra::multiply_mixed(row, col)(0, 0);
+    EXPECT_EQ(static_cast<float>(exact), mixed);
+    EXPECT_THROW(algebra::multiply_mixed(row, row), std::logic_error);
+    EXPECT_TRUE(algebra::multiply_mixed(algebra::DenseMatrixF(), col).empty());
+}
+
+TEST(HW1Test, SPARSE) {
+    using Format = algebra::SparseMatrix::Format;
+    algebra::DenseMatrix dense{{1, 0, 0, 2}, {0, 0, 3, 0}, {0, 0, 0, 0}, {4, 5, 0, 6}};
+
+    // test case: both layouts hold the same elements
+    algebra::SparseMatrix csr(dense), csc(dense, Format::csc);
+    EXPECT_EQ(csr.nonzeros(), 6u);
+    EXPECT_DOUBLE_EQ(csr.density(), 6.0 / 16);
+    EXPECT_EQ(csr.offsets(), (std::vector<size_t>{0, 2, 3, 3, 6}));
+    EXPECT_EQ(csc.offsets(), (std::vector<size_t>{0, 2, 3, 4, 6}));
+    EXPECT_EQ(csc.indices(), (std::vector<size_t>{0, 3, 3, 1, 0, 3}));
+    EXPECT_DOUBLE_EQ(csr(3, 1), 5);
+    EXPECT_DOUBLE_EQ(csc(1, 1), 0);
+    EXPECT_TRUE(csr.to_dense() == dense);
+    EXPECT_TRUE(csc.to_dense() == dense);
+    EXPECT_EQ(csr.to_format(Format::csc).indices(), csc.indices());
+    EXPECT_EQ(csc.to_format(Format::csr).values(), csr.values());
+    EXPECT_TRUE(algebra::transpose(csr).to_dense() == algebra::transpose(dense));
+
+    // test case: the triplets are sorted, the duplicates added and the zeros dropped
+    algebra::SparseMatrix built(4, 4, {{3, 3, 6}, {0, 3, 2}, {3, 0, 4}, {1, 2, 3}, {3, 1, 2}, {0, 0, 1},
+                                       {3, 1, 3}, {2, 2, 1}, {2, 2, -1}});
+    EXPECT_EQ(built.indices(), csr.indices());
+    EXPECT_EQ(built.values(), csr.values());
+    EXPECT_THROW(algebra::SparseMatrix(2, 2, {{2, 0, 1}}), std::logic_error);
+
+    // test case: the products and the sums agree with the dense functions in both layouts
+    algebra::DenseMatrix other{{1, 2}, {3, 4}, {5, 6}, {7, 8}};
+    algebra::DenseMatrix expected = algebra::multiply(dense, other);
+    EXPECT_TRUE(algebra::multiply(csr, other) == expected);
+    EXPECT_TRUE(algebra::multiply(csc, other) == expected);
+    EXPECT_TRUE(algebra::multiply(algebra::transpose(other), algebra::transpose(csr)) == algebra::transpose(expected));
+    EXPECT_TRUE(algebra::multiply(algebra::transpose(other), algebra::transpose(csc)) == algebra::transpose(expected));
+    EXPECT_TRUE(algebra::multiply(csr, csc).to_dense() == algebra::multiply(dense, dense));
+    EXPECT_EQ(algebra::multiply(csr, std::vector<double>{1, 2, 3, 4}), (std::vector<double>{9, 9, 0, 38}));
+    EXPECT_EQ(algebra::multiply(csc, std::vector<double>{1, 2, 3, 4}), (std::vector<double>{9, 9, 0, 38}));
+    EXPECT_TRUE(algebra::sum(csc, dense) == algebra::multiply(dense, 2.0));
+    EXPECT_TRUE(algebra::sum(dense, csr) == algebra::multiply(dense, 2.0));
+    EXPECT_THROW(algebra::multiply(csr, std::vector<double>{1, 2}), std::logic_error);
+    EXPECT_THROW(algebra::multiply(csr, algebra::transpose(other)), std::logic_error);
+    EXPECT_THROW(algebra::sum(csr, other), std::logic_error);
+
+    // test case: a mostly zero dense product takes the sparse path with the same result
+    algebra::DenseMatrix band(200, 200), full(200, 100);
+    algebra::random(full, algebra::Distribution::uniform, -1, 1, 5);
+    for (size_t i{}; i < 200; i++)
+        for (size_t j = i; j < std::min<size_t>(200, i + 3); j++) band(i, j) = 1.0 + i + j;
+    EXPECT_TRUE(algebra::prefer_sparse(band));
+    EXPECT_FALSE(algebra::prefer_sparse(full));
+    algebra::DenseMatrix automatic = algebra::multiply(band, full);
+    algebra::set_sparse_threshold(0);
+    EXPECT_FALSE(algebra::prefer_sparse(band));
+    algebra::DenseMatrix blocked = algebra::multiply(band, full);
+    algebra::set_sparse_threshold(algebra::sparse_threshold);
+    for (size_t i{}; i < 200; i++)
+        for (size_t j{}; j < 100; j++) EXPECT_NEAR(automatic(i, j), blocked(i, j), 1e-12);
+
+    // test case: a right operand with an infinity runs dense, the stored zeros give NaN as 0 * Inf does
+    algebra::DenseMatrix identity(300, 300), infinite(300, 300, 1.0);
+    for (size_t i{}; i < 300; i++) identity(i, i) = 1;
+    infinite(1, 0) = std::numeric_limits<double>::infinity();
+    EXPECT_TRUE(algebra::prefer_sparse(identity));
+    algebra::DenseMatrix product = algebra::multiply(identity, infinite);
+    EXPECT_TRUE(std::isnan(product(0, 0)));
+    EXPECT_EQ(product(1, 0), std::numeric_limits<double>::infinity());
+    EXPECT_EQ(product(0, 1), 1);
+}
+
+TEST(HW1Test, STRASSEN) {
+    // test case: odd sizes above the crossover, every dimension is peeled once
+    algebra::DenseMatrix a(1025, 1027), b(1027, 1031);
+    algebra::random(a, algebra::Distribution::uniform, -1, 1, 7);
+    algebra::random(b, algebra::Distribution::uniform, -1, 1, 8);
+    algebra::DenseMatrix fast = algebra::multiply_strassen(a, b);
+    algebra::set_strassen_threshold(0);
+    algebra::DenseMatrix classical = algebra::multiply(a, b);
+    EXPECT_EQ(fast.rows(), 1025u);
+    EXPECT_EQ(fast.cols(), 1031u);
+    for (size_t i{}; i < fast.rows(); i++)
+        for (size_t j{}; j < fast.cols(); j++) EXPECT_NEAR(fast(i, j), classical(i, j), 1e-11);
+
+    // test case: the automatic selection takes the same path
+    algebra::set_strassen_threshold(1000);
+    EXPECT_TRUE(algebra::prefer_strassen(1025, 1031, 1027));
+    EXPECT_FALSE(algebra::prefer_strassen(999, 1031, 1027));
+    EXPECT_TRUE(algebra::multiply(a, b) == fast);
+    algebra::set_strassen_threshold(algebra::strassen_threshold);
+
+    // test case: small products are the classical ones
+    algebra::DenseMatrix small{{1, 2}, {3, 4}, {5, 6}};
+    EXPECT_TRUE(algebra::multiply_strassen(small, algebra::transpose(small)) ==
+                algebra::multiply(small, algebra::transpose(small)));
+    EXPECT_TRUE(algebra::multiply_strassen(algebra::DenseMatrix{}, small).empty());
+    EXPECT_THROW(algebra::multiply_strassen(small, small), std::logic_error);
+}
+
+TEST(HW1Test, BLOCKED_ELIMINATION) {
+    // test case: several panels, P * A = L * U holds for the returned permutation
+    size_t n = 209;
+    algebra::DenseMatrix matrix(n, n);
+    algebra::random(matrix, algebra::Distribution::normal, 0, 1, 11);
+    algebra::DenseMatrix upper(matrix);
+    std::vector<size_t> permutation = algebra::upper_triangular_in_place(upper);
+    algebra::LU factorization(matrix);
+    EXPECT_EQ(permutation, factorization.pivot());
+    algebra::DenseMatrix product = algebra::multiply(factorization.lower(), upper);
+    for (size_t i{}; i < n; i++) {
+        for (size_t j{}; j < n; j++) {
+            EXPECT_NEAR(product(i, j), matrix(permutation[i], j), 1e-10);
+            if (j < i) {
+                EXPECT_EQ(upper(i, j), 0);
+            }
+        }
+    }
+    // Partial pivoting keeps every multiplier at most 1.
+    for (size_t i{}; i < n; i++)
+        for (size_t j{}; j < i; j++) EXPECT_LE(std::abs(factorization.factors()(i, j)), 1);
+
+    // test case: a zero column is skipped, the other columns are still eliminated
+    algebra::DenseMatrix singular(n, n);
+    algebra::random(singular, algebra::Distribution::normal, 0, 1, 12);
+    for (size_t i{}; i < n; i++) singular(i, 70) = 0;
+    EXPECT_EQ(algebra::determinant(singular), 0);
+    algebra::upper_triangular_in_place(singular);
+    EXPECT_EQ(singular(70, 70), 0);
+    EXPECT_EQ(singular(n - 1, n - 2), 0);
+}
+
+TEST(HW1Test, SOLVE) {
+    // Caution: the shapes must fit and the matrix must be invertible
+    EXPECT_TRUE(algebra::solve(Matrix{}, Matrix{}).empty());
+    EXPECT_THROW(algebra::solve(Matrix{{1, 2, 3}, {4, 5, 6}}, Matrix{{1}, {2}}), std::logic_error);
+    EXPECT_THROW(algebra::solve(Matrix{{1, 2}, {3, 4}}, Matrix{{1}, {2}, {3}}), std::logic_error);
+    EXPECT_THROW(algebra::solve(Matrix{{1, 2}, {2, 4}}, Matrix{{1}, {2}}), std::logic_error);
+
+    // test case: a small system
+    Matrix x{algebra::solve(Matrix{{2, 1}, {1, 3}}, Matrix{{3, 1}, {5, 2}})};
+    EXPECT_NEAR(x[0][0], 0.8, 1e-12);
+    EXPECT_NEAR(x[1][0], 1.4, 1e-12);
+    EXPECT_NEAR(x[0][1], 0.2, 1e-12);
+    EXPECT_NEAR(x[1][1], 0.6, 1e-12);
+
+    // test case: several blocks of rows, one factorization solves many right-hand sides
+    size_t n = 150;
+    algebra::DenseMatrix a(n, n), b(n, 70);
+    algebra::random(a, algebra::Distribution::uniform, -1, 1, 21);
+    algebra::random(b, algebra::Distribution::uniform, -1, 1, 22);
+    algebra::LU factorization(a);
+    algebra::DenseMatrix solution = factorization.solve(b), residual = algebra::multiply(a, solution);
+    for (size_t i{}; i < n; i++)
+        for (size_t j{}; j < b.cols(); j++) EXPECT_NEAR(residual(i, j), b(i, j), 1e-9);
+    std::vector<double> rhs(n, 1.0), vector_solution = algebra::solve(a, rhs);
+    algebra::DenseMatrix column = factorization.solve(algebra::DenseMatrix(n, 1, 1.0));
+    for (size_t i{}; i < n; i++) EXPECT_NEAR(vector_solution[i], column(i, 0), 1e-12);
+    algebra::DenseMatrixF single = algebra::solve(algebra::DenseMatrixF(a), algebra::DenseMatrixF(b));
+    EXPECT_NEAR(single(7, 3), solution(7, 3), 1e-3 * (1 + std::abs(solution(7, 3))));
+
+    // test case: Cholesky of a symmetric positive definite matrix
+    algebra::DenseMatrix spd = algebra::multiply(algebra::transpose(a), a);
+    for (size_t i{}; i < n; i++) spd(i, i) += n;
+    algebra::Cholesky cholesky(spd);
+    algebra::DenseMatrix product = algebra::multiply(cholesky.lower(), algebra::transpose(cholesky.lower()));
+    for (size_t i{}; i < n; i++) {
+        for (size_t j{}; j < n; j++) {
+            EXPECT_NEAR(product(i, j), spd(i, j), 1e-9);
+            if (j > i) {
+                EXPECT_EQ(cholesky.lower()(i, j), 0);
+            }
+        }
+    }
+    algebra::DenseMatrix spd_solution = cholesky.solve(b), spd_lu = algebra::solve(spd, b);
+    for (size_t i{}; i < n; i++)
+        for (size_t j{}; j < b.cols(); j++) EXPECT_NEAR(spd_solution(i, j), spd_lu(i, j), 1e-12);
+    EXPECT_NEAR(algebra::cholesky(Matrix{{4, 2, 0}, {2, 5, 1}, {0, 1, 3}}).determinant(), 44, 1e-12);
+    algebra::DenseMatrix identity = algebra::multiply(spd, cholesky.inverse());
+    for (size_t i{}; i < n; i++)
+        for (size_t j{}; j < n; j++) EXPECT_NEAR(identity(i, j), i == j, 1e-9);
+
+    // Caution: Cholesky needs a symmetric positive definite matrix
+    EXPECT_THROW(algebra::cholesky(Matrix{{1, 2}, {3, 4}}), std::logic_error);
+    EXPECT_THROW(algebra::cholesky(Matrix{{1, 2}, {2, 1}}), std::logic_error);
+    EXPECT_THROW(algebra::cholesky(Matrix{{1, 2, 3}, {2, 1, 3}}), std::logic_error);
+    EXPECT_THROW(cholesky.solve(algebra::DenseMatrix(n + 1, 1)), std::logic_error);
+}
+
+TEST(HW1Test, WORKSPACE) {
+    // test case: the scratch blocks are given back in reverse order, the chunks are merged once empty
+    algebra::Workspace& workspace = algebra::Workspace::local();
+    size_t used = workspace.used();
+    {
+        algebra::Scratch<double> outer(10);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(outer.data()) % 64, 0);
+        {
+            algebra::Scratch<float> inner(1 << 20);
+            inner[(1 << 20) - 1] = 1;
+            EXPECT_GE(workspace.used(), used + (1 << 22));
+        }
+        EXPECT_EQ(workspace.used(), used + 128);
+    }
+    EXPECT_EQ(workspace.used(), used);
+    size_t capacity = workspace.capacity();
+    { algebra::Scratch<char> all(capacity); }
+    EXPECT_EQ(workspace.capacity(), capacity);
+
+    // test case: once a computation has run, running it again takes no memory from the system
+    size_t n = 600;
+    algebra::set_buffer_cache_limit(size_t(1) << 28);
+    algebra::set_strassen_threshold(n);
+    algebra::DenseMatrix a(n, n), b(n, 40);
+    algebra::random(a, algebra::Distribution::uniform, -1, 1, 31);
+    algebra::random(b, algebra::Distribution::uniform, -1, 1, 32);
+    auto compute = [&]() {
+        algebra::DenseMatrix spd = algebra::multiply(algebra::transpose(a), a);
+        spd = algebra::sum(spd, algebra::multiply(algebra::DenseMatrix(n, n, 1.0), 0.0));
+        for (size_t i{}; i < n; i++) spd(i, i) += n;
+        algebra::DenseMatrix upper = algebra::upper_triangular(spd);
+        return algebra::Cholesky(spd).solve(b)(0, 0) + upper(n - 1, n - 1);
+    };
+    double expected = compute();
+    size_t allocations = algebra::heap_allocations();
+    EXPECT_EQ(compute(), expected);
+    EXPECT_EQ(algebra::heap_allocations(), allocations);
+
+    // Caution: without the cache every matrix takes its buffer from the system again
+    algebra::set_buffer_cache_limit(0);
+    algebra::set_strassen_threshold(algebra::strassen_threshold);
+    compute();
+    EXPECT_GT(algebra::heap_allocations(), allocations);
+    EXPECT_EQ(algebra::get_buffer_cache_limit(), 0);
+}
+
+TEST(HW1Test, EIGEN_SVD) {
+    // test case: a small symmetric matrix
+    algebra::SymmetricEigen small = algebra::eigen_symmetric(Matrix{{2, 1, 0}, {1, 2, 1}, {0, 1, 2}});
+    EXPECT_NEAR(small.values()[0], 2 - std::sqrt(2), 1e-12);
+    EXPECT_NEAR(small.values()[1], 2, 1e-12);
+    EXPECT_NEAR(small.values()[2], 2 + std::sqrt(2), 1e-12);
+    EXPECT_NEAR(std::abs(small.vectors()(1, 1)), 0, 1e-12);
+    EXPECT_NEAR(std::abs(small.vectors()(0, 1)), std::sqrt(0.5), 1e-12);
+
+    // test case: A * V = V * diag(values) and V^T * V = I, with repeated eigenvalues and several chunks
+    size_t n = 300;
+    algebra::DenseMatrix a(n, n);
+    algebra::random(a, algebra::Distribution::uniform, -1, 1, 41);
+    algebra::DenseMatrix symmetric = algebra::sum(a, algebra::transpose(a));
+    for (size_t i{}; i < 20; i++)
+        for (size_t j{}; j < n; j++) symmetric(i, j) = symmetric(j, i) = (i == j) * 3.0;
+    algebra::SymmetricEigen eigen(symmetric);
+    const algebra::DenseMatrix& v = eigen.vectors();
+    algebra::DenseMatrix av = algebra::multiply(symmetric, v), vtv = algebra::multiply(algebra::transpose(v), v);
+    for (size_t i{}; i < n; i++) {
+        for (size_t j{}; j < n; j++) {
+            EXPECT_NEAR(av(i, j), v(i, j) * eigen.values()[j], 1e-10);
+            EXPECT_NEAR(vtv(i, j), i == j, 1e-12);
+        }
+        if (i) {
+            EXPECT_LE(eigen.values()[i - 1], eigen.values()[i]);
+        }
+    }
+    EXPECT_EQ(std::count(eigen.values().begin(), eigen.values().end(), 3.0) +
+              std::count_if(eigen.values().begin(), eigen.values().end(),
+                            [](double value) { return value != 3.0 && std::abs(value - 3) < 1e-12; }), 20);
+    algebra::SymmetricEigen values_only(symmetric, false);
+    for (size_t i{}; i < n; i++) EXPECT_NEAR(values_only.values()[i], eigen.values()[i], 1e-10);
+    EXPECT_THROW(values_only.vectors(), std::logic_error);
+
+    // test case: the singular values of a tall and of a wide matrix, rank deficient
+    for (auto shape : {std::make_pair(size_t(250), size_t(90)), std::make_pair(size_t(70), size_t(161))}) {
+        algebra::DenseMatrix left(shape.first, 40), right(40, shape.second);
+        algebra::random(left, algebra::Distribution::uniform, -1, 1, 42);
+        algebra::random(right, algebra::Distribution::uniform, -1, 1, 43);
+        algebra::DenseMatrix b = algebra::multiply(left, right);
+        algebra::SVD decomposition = algebra::svd(b);
+        size_t k = std::min(shape.first, shape.second);
+        ASSERT_EQ(decomposition.values().size(), k);
+        EXPECT_EQ(decomposition.rank(), 40);
+        EXPECT_EQ(decomposition.u().rows(), shape.first);
+        EXPECT_EQ(decomposition.v().rows(), shape.second);
+        algebra::DenseMatrix us = decomposition.u();
+        for (size_t i{}; i < us.rows(); i++)
+            for (size_t j{}; j < k; j++) us(i, j) *= decomposition.values()[j];
+        algebra::DenseMatrix product = algebra::multiply(us, algebra::transpose(decomposition.v()));
+        for (size_t i{}; i < b.rows(); i++)
+            for (size_t j{}; j < b.cols(); j++) EXPECT_NEAR(product(i, j), b(i, j), 1e-10);
+        algebra::DenseMatrix vtv2 = algebra::multiply(algebra::transpose(decomposition.v()), decomposition.v());
+        for (size_t i{}; i < k; i++)
+            for (size_t j{}; j < k; j++) EXPECT_NEAR(vtv2(i, j), i == j, 1e-12);
+        // The squared singular values are the eigenvalues of B^T * B.
+        algebra::SymmetricEigen gram(algebra::multiply(algebra::transpose(b), b), false);
+        for (size_t i{}; i < 40; i++)
+            EXPECT_NEAR(decomposition.values()[i] * decomposition.values()[i],
+                        gram.values()[gram.size() - 1 - i], 1e-9 * gram.values().back());
+    }
+    EXPECT_TRUE(algebra::svd(algebra::DenseMatrix{}).values().empty());
+
+    // Caution: the eigen-decomposition needs a symmetric matrix
+    EXPECT_THROW(algebra::eigen_symmetric(Matrix{{1, 2}, {3, 4}}), std::logic_error);
+    EXPECT_THROW(algebra::eigen_symmetric(Matrix{{1, 2, 3}, {2, 1, 3}}), std::logic_error);
+}
+
+TEST(HW1Test, QR_LSTSQ) {
+    // test case: a small factorization
+    algebra::QR small = algebra::qr(Matrix{{3, 1}, {4, 2}, {0, 2}});
+    EXPECT_NEAR(std::abs(small.r()(0, 0)), 5, 1e-12);
+    EXPECT_NEAR(small.r()(1, 0), 0, 1e-12);
+    EXPECT_NEAR(std::abs(small.r()(0, 1)), 2.2, 1e-12);
+    EXPECT_NEAR(std::abs(small.r()(1, 1)), std::sqrt(4.16), 1e-12);
+
+    // test case: Q * R = A and Q^T * Q = I over several blocks and leaves, with a zero column
+    size_t m = 400, n = 150;
+    algebra::DenseMatrix a(m, n);
+    algebra::random(a, algebra::Distribution::uniform, -1, 1, 51);
+    for (size_t i{}; i < m; i++) a(i, 70) = 0;
+    algebra::QR factorization(a);
+    EXPECT_TRUE(factorization.rank_deficient());
+    algebra::DenseMatrix q = factorization.q(), r = factorization.r();
+    algebra::DenseMatrix product = algebra::multiply(q, r), qtq = algebra::multiply(algebra::transpose(q), q);
+    for (size_t i{}; i < m; i++)
+        for (size_t j{}; j < n; j++) EXPECT_NEAR(product(i, j), a(i, j), 1e-12);
+    for (size_t i{}; i < n; i++) {
+        for (size_t j{}; j < n; j++) EXPECT_NEAR(qtq(i, j), i == j, 1e-12);
+        for (size_t j{}; j < i; j++) EXPECT_EQ(r(i, j), 0);
+    }
+    algebra::DenseMatrix c(m, 3);
+    algebra::random(c, algebra::Distribution::uniform, -1, 1, 52);
+    algebra::DenseMatrix back = factorization.apply_q(factorization.apply_qt(c));
+    for (size_t i{}; i < m; i++)
+        for (size_t j{}; j < 3; j++) EXPECT_NEAR(back(i, j), c(i, j), 1e-12);
+
+    // test case: the least-squares residual is orthogonal to the columns, consistent systems are solved exactly
+    for (size_t i{}; i < m; i++) a(i, 70) = std::sin(double(i));
+    algebra::DenseMatrix b(m, 4);
+    algebra::random(b, algebra::Distribution::uniform, -1, 1, 53);
+    algebra::DenseMatrix x = algebra::lstsq(a, b);
+    ASSERT_EQ(x.rows(), n);
+    algebra::DenseMatrix residual = algebra::sum(algebra::multiply(a, x), algebra::multiply(b, -1.0));
+    algebra::DenseMatrix normal = algebra::multiply(algebra::transpose(a), residual);
+    for (size_t i{}; i < n; i++)
+        for (size_t j{}; j < 4; j++) EXPECT_NEAR(normal(i, j), 0, 1e-10);
+    std::vector<double> exact(n), rhs(m);
+    for (size_t j{}; j < n; j++) exact[j] = double(j) / n;
+    for (size_t i{}; i < m; i++)
+        for (size_t j{}; j < n; j++) rhs[i] += a(i, j) * exact[j];
+    std::vector<double> solution = algebra::lstsq(a, rhs);
+    for (size_t j{}; j < n; j++) EXPECT_NEAR(solution[j], exact[j], 1e-12);
+    Matrix line = algebra::lstsq(Matrix{{1, 0}, {1, 1}, {1, 2}}, Matrix{{1}, {2}, {4}});
+    EXPECT_NEAR(line[0][0], 5.0 / 6, 1e-12);
+    EXPECT_NEAR(line[1][0], 1.5, 1e-12);
+
+    // test case: a wide system gets the solution of the smallest norm
+    algebra::DenseMatrix wide = algebra::transpose(a), target(n, 2);
+    algebra::random(target, algebra::Distribution::uniform, -1, 1, 54);
+    algebra::DenseMatrix minimum = algebra::lstsq(wide, target), reached = algebra::multiply(wide, minimum);
+    for (size_t i{}; i < n; i++)
+        for (size_t j{}; j < 2; j++) EXPECT_NEAR(reached(i, j), target(i, j), 1e-10);
+    algebra::DenseMatrix range = algebra::multiply(a, algebra::solve(algebra::multiply(wide, a), target));
+    for (size_t i{}; i < m; i++)
+        for (size_t j{}; j < 2; j++) EXPECT_NEAR(minimum(i, j), range(i, j), 1e-10);
+    algebra::DenseMatrixF single = algebra::lstsq(algebra::DenseMatrixF(a), algebra::DenseMatrixF(b));
+    EXPECT_NEAR(single(5, 1), x(5, 1), 1e-3 * (1 + std::abs(x(5, 1))));
+
+    // Caution: the right-hand side must fit and the columns must be independent
+    EXPECT_THROW(algebra::qr(Matrix{{1, 2, 3}, {4, 5, 6}}).solve(std::vector<double>{1, 2}), std::logic_error);
+    EXPECT_THROW(algebra::lstsq(Matrix{{1, 2}, {3, 4}, {5, 6}}, Matrix{{1}, {2}}), std::logic_error);
+    EXPECT_THROW(algebra::lstsq(Matrix{{1, 2}, {2, 4}, {3, 6}}, Matrix{{1}, {2}, {3}}), std::logic_error);
+    EXPECT_THROW(factorization.apply_q(algebra::DenseMatrix(m + 1, 1)), std::logic_error);
+}
+
+TEST(HW1Test, ISA_DISPATCH) {
+    // test case: the generic variant always runs, the widest supported one is the default
+    algebra::Isa previous = algebra::get_isa();
+    EXPECT_TRUE(algebra::isa_supported(algebra::Isa::generic));
+    EXPECT_TRUE(algebra::isa_supported(algebra::best_isa()));
+    EXPECT_STREQ(algebra::isa_name(algebra::Isa::avx512), "avx512");
+
+    // test case: every supported variant agrees with the generic one up to rounding
+    algebra::DenseMatrix matrix1(211, 190), matrix2(190, 203), square(300, 300);
+    algebra::random(matrix1, algebra::Distribution::uniform, -1, 1, 1);
+    algebra::random(matrix2, algebra::Distribution::uniform, -1, 1, 2);
+    algebra::random(square, algebra::Distribution::normal, 0, 1, 3);
+    algebra::DenseMatrixF float1(matrix1), float2(matrix2);
+    algebra::set_isa(algebra::Isa::generic);
+    EXPECT_EQ(algebra::get_isa(), algebra::Isa::generic);
+    algebra::DenseMatrix product = algebra::multiply(matrix1, matrix2);
+    algebra::DenseMatrixF float_product = algebra::multiply(float1, float2);
+    algebra::DenseMatrix total = algebra::sum(algebra::multiply(matrix1, 2.0), matrix1);
+    algebra::DenseMatrix upper = algebra::upper_triangular(square);
+    for (algebra::Isa isa : {algebra::Isa::avx2, algebra::Isa::avx512}) {
+        if (!algebra::isa_supported(isa)) {
+            EXPECT_THROW(algebra::set_isa(isa), std::logic_error);
+            continue;
+        }
+        algebra::set_isa(isa);
+        EXPECT_EQ(algebra::get_isa(), isa);
+        algebra::DenseMatrix product_isa = algebra::multiply(matrix1, matrix2);
+        algebra::DenseMatrixF float_product_isa = algebra::multiply(float1, float2);
+        for (size_t i{}; i < product.rows(); i++) {
+            for (size_t j{}; j < product.cols(); j++) {
+                EXPECT_NEAR(product_isa(i, j), product(i, j), 1e-12);
+                EXPECT_NEAR(float_product_isa(i, j), float_product(i, j), 1e-4);
+            }
+        }
+        EXPECT_TRUE(algebra::sum(algebra::multiply(matrix1, 2.0), matrix1) == total);
+        EXPECT_TRUE(algebra::transpose(matrix1) == algebra::DenseMatrix(algebra::transpose(matrix1.to_matrix())));
+        algebra::DenseMatrix upper_isa = algebra::upper_triangular(square);
+        for (size_t i{}; i < square.rows(); i++)
+            for (size_t j{}; j < square.cols(); j++) EXPECT_NEAR(upper_isa(i, j), upper(i, j), 1e-9);
+    }
+    algebra::set_isa(previous);
 }
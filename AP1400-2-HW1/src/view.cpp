@@ -0,0 +1,247 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#include <algorithm>
+#include <stdexcept>
+#include "algebra.h"
+#include "elementwise.h"
+#include "gemm.h"
+#include "transpose.h"
+#include "view.h"
+
+using std::logic_error;
+using std::max;
+using std::min;
+
+namespace algebra {
+    View::View() : _rows(0), _cols(0), _blocks(), _count(0) {}
+
+    View::View(const DenseMatrix &matrix) : View(matrix.data(), matrix.rows(), matrix.cols(), matrix.stride()) {}
+
+    View::View(const double *data, size_t rows, size_t cols, size_t stride) : View() {
+        _rows = rows;
+        _cols = cols;
+        add_block({0, 0, data, rows, cols, stride});
+    }
+
+    size_t View::rows() const {
+        return _rows;
+    }
+
+    size_t View::cols() const {
+        return _cols;
+    }
+
+    bool View::empty() const {
+        return _rows == 0 || _cols == 0;
+    }
+
+    double View::operator()(size_t r, size_t c) const {
+        for (const Block &block : *this) {
+            if (r >= block.row && r < block.row + block.rows && c >= block.col && c < block.col + block.cols)
+                return block.data[(r - block.row) * block.stride + c - block.col];
+        }
+        throw logic_error("The element is out of the view.");
+    }
+
+    const View::Block *View::begin() const {
+        return _blocks.data();
+    }
+
+    const View::Block *View::end() const {
+        return _blocks.data() + _count;
+    }
+
+    size_t View::block_count() const {
+        return _count;
+    }
+
+    DenseMatrix View::to_dense() const {
+        DenseMatrix res(_rows, _cols);
+        // Copy every piece row by row into its place.
+        for (const Block &block : *this)
+            for (size_t i = 0; i < block.rows; i++)
+                std::copy(block.data + i * block.stride, block.data + i * block.stride + block.cols,
+                          res.row(block.row + i) + block.col);
+        return res;
+    }
+
+    void View::add_block(const Block &block) {
+        // Skip the empty pieces.
+        if (!block.rows || !block.cols) return;
+        if (_count == max_blocks)
+            throw logic_error("The view has too many pieces, copy it into a DenseMatrix first.");
+        _blocks[_count++] = block;
+    }
+
+    View submatrix(const View &view, size_t row, size_t col, size_t rows, size_t cols) {
+        // Check if the submatrix is inside the view
+        if (row + rows > view.rows() || col + cols > view.cols())
+            throw logic_error("The submatrix is out of range.");
+        View res;
+        res._rows = rows;
+        res._cols = cols;
+        // Keep the intersection of every piece with the window.
+        for (const View::Block &block : view) {
+            size_t r0 = max(row, block.row), r1 = min(row + rows, block.row + block.rows);
+            size_t c0 = max(col, block.col), c1 = min(col + cols, block.col + block.cols);
+            if (r0 >= r1 || c0 >= c1) continue;
+            res.add_block({r0 - row, c0 - col,
+                           block.data + (r0 - block.row) * block.stride + c0 - block.col,
+                           r1 - r0, c1 - c0, block.stride});
+        }
+        return res;
+    }
+
+    View slice_rows(const View &view, size_t first, size_t count) {
+        return submatrix(view, first, 0, count, view.cols());
+    }
+
+    View minor(const View &view, size_t n, size_t m) {
+        // Check if n and m are within the bounds of the view dimensions
+        if (n >= view.rows() || m >= view.cols())
+            throw logic_error("Illegal parameter n or m");
+        View res;
+        res._rows = view.rows() - 1;
+        res._cols = view.cols() - 1;
+        for (const View::Block &block : view) {
+            // Split the piece at the skipped row and column into at most four parts.
+            size_t top = n < block.row ? 0 : min(block.rows, n - block.row);
+            size_t bottom = n < block.row ? 0 : min(block.rows, n - block.row + 1);
+            size_t left = m < block.col ? 0 : min(block.cols, m - block.col);
+            size_t right = m < block.col ? 0 : min(block.cols, m - block.col + 1);
+            // The parts after the skipped row or column move up or left by one.
+            size_t row_after = block.row + bottom - (n < block.row + bottom ? 1 : 0);
+            size_t col_after = block.col + right - (m < block.col + right ? 1 : 0);
+            const double *data = block.data;
+            res.add_block({block.row, block.col, data, top, left, block.stride});
+            res.add_block({block.row, col_after, data + right, top, block.cols - right, block.stride});
+            res.add_block({row_after, block.col, data + bottom * block.stride,
+                           block.rows - bottom, left, block.stride});
+            res.add_block({row_after, col_after, data + bottom * block.stride + right,
+                           block.rows - bottom, block.cols - right, block.stride});
+        }
+        return res;
+    }
+
+    View concatenate(const View &view1, const View &view2, int axis) {
+        // If one view is empty, return another
+        if (view1.empty()) return view2;
+        if (view2.empty()) return view1;
+        View res(view1);
+        size_t row_offset = 0, col_offset = 0;
+        if (!axis) {
+            // Stack vertically, both should have the same number of columns
+            if (view1.cols() != view2.cols())
+                throw logic_error("The two matrix should have same row length.");
+            row_offset = view1.rows();
+            res._rows += view2.rows();
+        } else if (axis == 1) {
+            // Stack horizontally, both should have the same number of rows
+            if (view1.rows() != view2.rows())
+                throw logic_error("The two matrices should have the same number of rows.");
+            col_offset = view1.cols();
+            res._cols += view2.cols();
+        } else throw logic_error("The axis should be 0 or 1.");
+        for (View::Block block : view2) {
+            block.row += row_offset;
+            block.col += col_offset;
+            res.add_block(block);
+        }
+        return res;
+    }
+
+    DenseMatrix multiply(const View &view, double c) {
+        // Check if the view is empty, and throw an exception if so.
+        if (view.empty()) throw logic_error("The matrix should not be empty.");
+        DenseMatrix res(view.rows(), view.cols());
+        for (const View::Block &block : view)
+            for (size_t i = 0; i < block.rows; i++)
+                kernel::scale(block.data + i * block.stride, c, res.row(block.row + i) + block.col, block.cols);
+        return res;
+    }
+
+    DenseMatrix multiply(const View &view1, const View &view2) {
+        // Check if either view is empty, and return an empty matrix if so.
+        if (view1.empty() || view2.empty()) return {};
+        // Check for compatible dimensions for matrix multiplication.
+        if (view1.cols() != view2.rows())
+            throw logic_error("The number of columns in the first matrix must equal "
+                              "the number of rows in the second matrix.");
+        DenseMatrix res(view1.rows(), view2.cols());
+        // Every pair of pieces sharing a range of the inner dimension adds its product into its place.
+        for (const View::Block &a : view1) {
+            for (const View::Block &b : view2) {
+                size_t k0 = max(a.col, b.row), k1 = min(a.col + a.cols, b.row + b.rows);
+                if (k0 >= k1) continue;
+                kernel::gemm_parallel(a.rows, b.cols, k1 - k0,
+                                      a.data + k0 - a.col, a.stride,
+                                      b.data + (k0 - b.row) * b.stride, b.stride,
+                                      res.row(a.row) + b.col, res.stride());
+            }
+        }
+        return res;
+    }
+
+    DenseMatrix sum(const View &view, double c) {
+        // Check if the view is empty, return an empty matrix.
+        if (view.empty()) return {};
+        DenseMatrix res(view.rows(), view.cols());
+        for (const View::Block &block : view)
+            for (size_t i = 0; i < block.rows; i++)
+                kernel::shift(block.data + i * block.stride, c, res.row(block.row + i) + block.col, block.cols);
+        return res;
+    }
+
+    DenseMatrix sum(const View &view1, const View &view2) {
+        // Check if both views are empty, return an empty matrix if so.
+        if (view1.empty() && view2.empty()) return {};
+        // Check if either view is empty, throw an error if so.
+        if (view1.empty() || view2.empty())
+            throw logic_error("There is at least an empty matrix");
+        // Check if both views have same dimensions.
+        if (view1.rows() != view2.rows() || view1.cols() != view2.cols())
+            throw logic_error("Both matrices must have the same dimensions.");
+        // Copy the first view, then add the pieces of the second one into their places.
+        DenseMatrix res{view1.to_dense()};
+        for (const View::Block &block : view2) {
+            for (size_t i = 0; i < block.rows; i++) {
+                double *dst = res.row(block.row + i) + block.col;
+                kernel::add(dst, block.data + i * block.stride, dst, block.cols);
+            }
+        }
+        return res;
+    }
+
+    DenseMatrix transpose(const View &view) {
+        // Check if the view is empty, return an empty matrix if true
+        if (view.empty()) return {};
+        DenseMatrix res(view.cols(), view.rows());
+        // Every piece lands at the mirrored place.
+        for (const View::Block &block : view)
+            kernel::transpose(block.rows, block.cols, block.data, block.stride,
+                              res.row(block.col) + block.row, res.stride());
+        return res;
+    }
+
+    double determinant(const View &view) {
+        // The factorization works on its own copy anyway.
+        if (view.empty()) return 1;
+        return determinant(view.to_dense());
+    }
+
+    DenseMatrix inverse(const View &view) {
+        if (view.empty()) return {};
+        return inverse(view.to_dense());
+    }
+
+    DenseMatrix upper_triangular(const View &view) {
+        if (view.empty()) return {};
+        // Copy the view once and work on it
+        DenseMatrix res{view.to_dense()};
+        upper_triangular_in_place(res);
+        return res;
+    }
+}
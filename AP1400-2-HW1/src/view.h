@@ -0,0 +1,113 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_VIEW_H
+#define SRC_VIEW_H
+
+#include <array>
+#include "dense_matrix.h"
+#include "expression.h"
+
+namespace algebra {
+    // A non-owning view of a matrix made of up to max_blocks rectangular pieces of DenseMatrix buffers.
+    // A submatrix is one piece, a minor is up to four pieces around the skipped row and column,
+    // and a concatenation puts the pieces of two views side by side, so building any of them is O(1)
+    // and allocates nothing. The viewed matrices must outlive the view.
+    class View : public expression::Expression<View> {
+    public:
+        // The maximum number of pieces of a view.
+        static constexpr size_t max_blocks = 16;
+
+        // A piece of the view: a rows*cols strided buffer placed at (row, col) of the view.
+        struct Block {
+            size_t row;
+            size_t col;
+            const double *data;
+            size_t rows;
+            size_t cols;
+            size_t stride;
+        };
+
+        // Default constructor that will create an empty 0*0 view.
+        View();
+
+        // Constructor that views the whole matrix.
+        View(const DenseMatrix &matrix);
+
+        // Constructor that views a rows*cols strided buffer.
+        View(const double *data, size_t rows, size_t cols, size_t stride);
+
+        // Return the shape of the view.
+        size_t rows() const;
+        size_t cols() const;
+
+        // Return true if the view has no element.
+        bool empty() const;
+
+        // Return the element at rth row and cth column, it searches the pieces so prefer the kernels.
+        double operator()(size_t r, size_t c) const;
+
+        // Return the pieces of the view.
+        const Block *begin() const;
+        const Block *end() const;
+        size_t block_count() const;
+
+        // Copy the viewed elements into a new matrix.
+        DenseMatrix to_dense() const;
+
+    private:
+        size_t _rows;
+        size_t _cols;
+        std::array<Block, max_blocks> _blocks;
+        size_t _count;
+
+        // A helper method to add a non-empty piece, throw logic_error if there are too many.
+        void add_block(const Block &block);
+
+        friend View submatrix(const View &view, size_t row, size_t col, size_t rows, size_t cols);
+        friend View minor(const View &view, size_t n, size_t m);
+        friend View concatenate(const View &view1, const View &view2, int axis);
+    };
+
+    // Return a view of the rows*cols submatrix starting at the given row and column.
+    View submatrix(const View &view, size_t row, size_t col, size_t rows, size_t cols);
+
+    // Return a view of count rows starting at the given row.
+    View slice_rows(const View &view, size_t first, size_t count);
+
+    // Return a view of the minor of the input view with respect to nth row and mth column.
+    View minor(const View &view, size_t n, size_t m);
+
+    // Return a view which stacks view1 and view2 along the given axis, 0 vertically and 1 horizontally.
+    View concatenate(const View &view1, const View &view2, int axis = 0);
+
+    // The algebra functions below read the views directly, only the result is allocated.
+
+    // Return a new matrix that multiplies the given view into the given constant scalar c.
+    DenseMatrix multiply(const View &view, double c);
+
+    // Return a new matrix that multiplies the given view1 into given view2.
+    DenseMatrix multiply(const View &view1, const View &view2);
+
+    // Return a new matrix that adds the constant number c to every element of given view.
+    DenseMatrix sum(const View &view, double c);
+
+    // Return a new matrix that adds 2 views to each other.
+    DenseMatrix sum(const View &view1, const View &view2);
+
+    // Return a transpose matrix of the input view.
+    DenseMatrix transpose(const View &view);
+
+    // Return the calculation of the determinant of the input view.
+    double determinant(const View &view);
+
+    // Return the view's inverse.
+    DenseMatrix inverse(const View &view);
+
+    // Return the upper triangular form of the view.
+    DenseMatrix upper_triangular(const View &view);
+}
+
+#endif //SRC_VIEW_H
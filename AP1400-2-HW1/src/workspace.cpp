@@ -0,0 +1,176 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <new>
+#include "workspace.h"
+
+namespace algebra {
+    // Every block is aligned on a cache line, like the rows of the matrices.
+    static constexpr size_t alignment = 64;
+
+    // The smallest chunk a workspace takes from the system.
+    static constexpr size_t workspace_chunk = 64 * 1024;
+
+    // The blocks a workspace keeps track of without growing, deeper than the kernels nest.
+    static constexpr size_t workspace_marks = 64;
+
+    // The number of blocks taken from the system.
+    static std::atomic<size_t> allocations(0);
+
+    // The freed buffers by size, the number of bytes they hold and the limit of that number.
+    static std::mutex cache_mutex;
+    static std::map<size_t, std::vector<void *>> cache;
+    static size_t cached = 0;
+    static size_t cache_limit = 0;
+
+    // A helper function to take an aligned block from the system.
+    static void *system_allocate(size_t bytes) {
+        void *p = nullptr;
+        if (posix_memalign(&p, alignment, std::max(bytes, size_t(1)))) throw std::bad_alloc();
+        allocations++;
+        return p;
+    }
+
+    // A helper function to free cached buffers until the cache holds at most limit bytes, the mutex is held.
+    static void trim(size_t limit) {
+        for (auto it = cache.begin(); it != cache.end() && cached > limit;) {
+            while (!it->second.empty() && cached > limit) {
+                std::free(it->second.back());
+                it->second.pop_back();
+                cached -= it->first;
+            }
+            it = it->second.empty() ? cache.erase(it) : std::next(it);
+        }
+    }
+
+    void *allocate_buffer(size_t bytes) {
+        {
+            std::lock_guard<std::mutex> lock(cache_mutex);
+            auto it = cache.find(bytes);
+            if (it != cache.end() && !it->second.empty()) {
+                void *p = it->second.back();
+                it->second.pop_back();
+                cached -= bytes;
+                return p;
+            }
+        }
+        return system_allocate(bytes);
+    }
+
+    void release_buffer(void *p, size_t bytes) {
+        if (!p) return;
+        {
+            std::lock_guard<std::mutex> lock(cache_mutex);
+            if (cached + bytes <= cache_limit) {
+                // The vector of a size keeps its capacity, so once warm the cache does not allocate either.
+                cache[bytes].push_back(p);
+                cached += bytes;
+                return;
+            }
+        }
+        std::free(p);
+    }
+
+    void set_buffer_cache_limit(size_t bytes) {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        cache_limit = bytes;
+        trim(bytes);
+    }
+
+    size_t get_buffer_cache_limit() {
+        std::lock_guard<std::mutex> lock(cache_mutex);
+        return cache_limit;
+    }
+
+    size_t heap_allocations() {
+        return allocations;
+    }
+
+    Workspace::Workspace() {
+        _marks.reserve(workspace_marks);
+    }
+
+    Workspace::~Workspace() {
+        for (const Chunk& chunk : _chunks) std::free(chunk.data);
+    }
+
+    Workspace& Workspace::local() {
+        thread_local Workspace workspace;
+        return workspace;
+    }
+
+    void *Workspace::take(size_t bytes) {
+        // Round up so the next block stays aligned.
+        bytes = (bytes + alignment - 1) / alignment * alignment;
+        if (_chunks.empty() || _top + bytes > _chunks.back().size) {
+            // Double the capacity at least, so a growing computation takes few chunks.
+            size_t size = std::max({bytes, capacity(), workspace_chunk});
+            _chunks.push_back({static_cast<char *>(system_allocate(size)), size});
+            _top = 0;
+        }
+        char *p = _chunks.back().data + _top;
+        _top += bytes;
+        _used += bytes;
+        _peak = std::max(_peak, _used);
+        _marks.emplace_back(p, bytes);
+        return p;
+    }
+
+    void Workspace::give_back(void *p) noexcept {
+        // Check if the block is in use
+        assert(std::any_of(_marks.begin(), _marks.end(), [p](const std::pair<char *, size_t>& mark) {
+            return mark.first == p;
+        }));
+        // The blocks taken after this one are given back with it.
+        char *block;
+        do {
+            block = _marks.back().first;
+            _used -= _marks.back().second;
+            _marks.pop_back();
+        } while (block != p);
+        // The top goes back to the block if it is in the last chunk, otherwise the last chunk is now free.
+        const Chunk& last = _chunks.back();
+        _top = block >= last.data && block < last.data + last.size ? block - last.data : 0;
+        if (_marks.empty() && _chunks.size() > 1) merge();
+    }
+
+    size_t Workspace::used() const {
+        return _used;
+    }
+
+    size_t Workspace::capacity() const {
+        size_t res = 0;
+        for (const Chunk& chunk : _chunks) res += chunk.size;
+        return res;
+    }
+
+    void Workspace::reserve(size_t bytes) {
+        bytes = (bytes + alignment - 1) / alignment * alignment;
+        // Taking the block adds a chunk if it does not fit, giving it back leaves the room on top.
+        if (bytes && (_chunks.empty() || _top + bytes > _chunks.back().size)) give_back(take(bytes));
+    }
+
+    size_t Workspace::peak() const {
+        return _peak;
+    }
+
+    void Workspace::reset_peak() {
+        _peak = _used;
+    }
+
+    void Workspace::merge() {
+        size_t size = capacity();
+        for (const Chunk& chunk : _chunks) std::free(chunk.data);
+        _chunks.clear();
+        _chunks.push_back({static_cast<char *>(system_allocate(size)), size});
+        _top = 0;
+    }
+}
@@ -0,0 +1,142 @@
+//
+// Created by Daniel X Feng
+// Created Date: 17 Oct 2026.
+//
+
+#ifndef SRC_WORKSPACE_H
+#define SRC_WORKSPACE_H
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// The memory behind the algebra functions: a cache of matrix buffers and a scratch stack per thread.
+// The scratch stacks keep their memory, but the buffer cache is off by default. Once it is turned on with
+// set_buffer_cache_limit and a computation has run, running it again takes no more memory from the system.
+namespace algebra {
+    // Return a block of the given size aligned on a cache line, from the buffer cache if it holds one of that size.
+    // Throw bad_alloc if the system has no memory left.
+    void *allocate_buffer(size_t bytes);
+
+    // Give back a block of allocate_buffer, it is kept in the cache while the cache is below its limit.
+    void release_buffer(void *p, size_t bytes);
+
+    // The freed buffers of the matrices are kept for reuse up to this number of bytes.
+    // The default is 0, every buffer goes back to the system at once. Lowering the limit trims the cache.
+    void set_buffer_cache_limit(size_t bytes);
+    size_t get_buffer_cache_limit();
+
+    // Return the number of blocks the buffer cache and the workspaces have taken from the system, on all threads.
+    size_t heap_allocations();
+
+    // A std allocator over allocate_buffer, e.g. for the control blocks of the shared buffers.
+    template <typename T>
+    struct BufferAllocator {
+        using value_type = T;
+
+        BufferAllocator() = default;
+
+        template <typename U>
+        BufferAllocator(const BufferAllocator<U> &) {}
+
+        T *allocate(size_t n) { return static_cast<T *>(allocate_buffer(n * sizeof(T))); }
+        void deallocate(T *p, size_t n) { release_buffer(p, n * sizeof(T)); }
+
+        template <typename U>
+        bool operator==(const BufferAllocator<U> &) const { return true; }
+        template <typename U>
+        bool operator!=(const BufferAllocator<U> &) const { return false; }
+    };
+
+    // A vector over allocate_buffer, for the small results which outlive a scratch block, e.g. the pivots of an LU.
+    template <typename T>
+    using BufferVector = std::vector<T, BufferAllocator<T>>;
+
+    // A stack of scratch memory owned by one thread, for the intermediates of the kernels.
+    // The blocks are given back in the reverse order they were taken. When the stack runs out of room
+    // it takes another chunk from the system, and once it is empty again the chunks are merged into one,
+    // so after the first run of a computation all its intermediates fit in a single chunk.
+    class Workspace {
+    public:
+        // Constructor that makes room for the marks of the blocks, so a stack used by the kernels never grows them.
+        Workspace();
+
+        // Copy is forbidden, the blocks point into the chunks.
+        Workspace(const Workspace &other) = delete;
+        Workspace &operator=(const Workspace &other) = delete;
+
+        // Destructor that gives the chunks back to the system.
+        ~Workspace();
+
+        // Return the workspace of the calling thread.
+        static Workspace &local();
+
+        // Return bytes of memory aligned on a cache line.
+        void *take(size_t bytes);
+
+        // Give back the last block taken, and everything taken after it.
+        // The block must be in use, it is checked by an assertion only since the destructor of Scratch calls this.
+        void give_back(void *p) noexcept;
+
+        // Return the number of bytes in use.
+        size_t used() const;
+
+        // Return the number of bytes owned, in use or not.
+        size_t capacity() const;
+
+        // Make room for bytes more on top of the stack, so taking them later does not go to the system.
+        void reserve(size_t bytes);
+
+        // Return the largest number of bytes in use since the last reset_peak.
+        size_t peak() const;
+        void reset_peak();
+
+    private:
+        struct Chunk {
+            char *data;
+            size_t size;
+        };
+
+        // The chunks, only the last one has room left.
+        std::vector<Chunk> _chunks;
+        // The number of bytes taken from the last chunk.
+        size_t _top = 0;
+        // The number of bytes in use, in all the chunks.
+        size_t _used = 0;
+        // The largest value of _used since the last reset_peak.
+        size_t _peak = 0;
+        // The blocks in use with their rounded sizes, the last one is on the top of the stack.
+        std::vector<std::pair<char *, size_t>> _marks;
+
+        // A helper method to replace all the chunks by one, called when the stack is empty.
+        void merge();
+    };
+
+    // count elements of T from the workspace of the calling thread, given back when it goes out of scope.
+    // The elements are not initialized.
+    template <typename T>
+    class Scratch {
+    public:
+        explicit Scratch(size_t count)
+                : _data(static_cast<T *>(Workspace::local().take(count * sizeof(T)))), _size(count) {}
+
+        Scratch(const Scratch &other) = delete;
+        Scratch &operator=(const Scratch &other) = delete;
+
+        ~Scratch() { Workspace::local().give_back(_data); }
+
+        T *data() { return _data; }
+        const T *data() const { return _data; }
+
+        T &operator[](size_t i) { return _data[i]; }
+        const T &operator[](size_t i) const { return _data[i]; }
+
+        size_t size() const { return _size; }
+
+    private:
+        T *_data;
+        size_t _size;
+    };
+}
+
+#endif //SRC_WORKSPACE_H